@@ -0,0 +1,72 @@
+#include "BenchmarkGraphs.hpp"
+#include "GraphGenerator.hpp"
+#include "TripleRomanDomination.hpp"
+#include "util_functions.hpp"
+#include <memory>
+#include <mutex>
+
+namespace {
+
+struct GraphSpecification {
+    std::string name;
+    size_t order;
+    double probability;
+};
+
+// an order of 0 stands for the bundled graph file.
+const std::vector<GraphSpecification>& specifications() {
+    static const std::vector<GraphSpecification> list {
+        {"file-100-0.5", 0, 0.0},
+        {"gnp-100-sparse", 100, 4.0 / 99},
+        {"gnp-100-dense", 100, 0.5},
+        {"gnp-1000-sparse", 1000, 4.0 / 999},
+        {"gnp-1000-dense", 1000, 0.5},
+        {"gnp-10000-sparse", 10000, 4.0 / 9999},
+    };
+
+    return list;
+}
+
+std::unique_ptr<BenchmarkGraph> buildGraph(const GraphSpecification& specification) {
+    CSRGraph graph { specification.order == 0 ? CSRGraph(bundledGraphFile()) :
+        generateErdosRenyiGraph(specification.order, specification.probability, specification.order) };
+
+    setRandomSeed(1);
+
+    Chromosome feasible_solution { TripleRomanDomination::heuristic3(graph) };
+    Chromosome random_labels(graph.getOrder());
+
+    for (auto& gene : random_labels.genes) {
+        constexpr Gene labels[] {0, 2, 3, 4};
+        gene = labels[getRandomInt(0, 3)];
+    }
+
+    fitness(random_labels);
+
+    return std::make_unique<BenchmarkGraph>(
+        BenchmarkGraph {specification.name, std::move(graph), std::move(feasible_solution), std::move(random_labels)});
+}
+
+} // namespace
+
+const std::string& bundledGraphFile() {
+    static const std::string filename { "input_file/random_graph11-order100-edge_probability-0.5.txt" };
+    return filename;
+}
+
+size_t benchmarkGraphCount() { return specifications().size(); }
+
+const std::string& benchmarkGraphName(size_t index) { return specifications()[index].name; }
+
+const BenchmarkGraph& benchmarkGraph(size_t index) {
+    static std::vector<std::unique_ptr<BenchmarkGraph>> graphs(specifications().size());
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!graphs[index]) {
+        graphs[index] = buildGraph(specifications()[index]);
+    }
+
+    return *graphs[index];
+}
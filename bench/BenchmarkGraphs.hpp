@@ -0,0 +1,28 @@
+#ifndef BENCHMARK_GRAPHS_HPP
+#define BENCHMARK_GRAPHS_HPP
+
+#include <string>
+#include <vector>
+#include "CSRGraph.hpp"
+#include "Chromosome.hpp"
+
+// The graph matrix shared by the micro-benchmarks: the bundled 100-vertex graph plus G(n, p) graphs of several
+// orders, sparse (average degree 4) and dense (p = 0.5). Graphs and their fixtures are built on first use and kept
+// for the whole run, so building them is never timed.
+
+struct BenchmarkGraph {
+    std::string name;
+    CSRGraph graph;
+    Chromosome feasible_solution;
+    Chromosome random_labels;
+};
+
+const std::string& bundledGraphFile();
+
+size_t benchmarkGraphCount();
+
+const std::string& benchmarkGraphName(size_t index);
+
+const BenchmarkGraph& benchmarkGraph(size_t index);
+
+#endif
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON outputs (`make bench-baseline` and `make bench`).
+
+Prints, for every benchmark present in both files, the baseline and current real time per iteration and their
+ratio, flagging changes beyond the threshold. Exits with status 1 when `--fail-on-regression` is given and some
+benchmark got slower than the threshold allows.
+"""
+
+import argparse
+import json
+import sys
+
+UNIT_NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path) as file:
+        data = json.load(file)
+
+    times = {}
+
+    for entry in data.get("benchmarks", []):
+        # with --benchmark_repetitions, only the median is compared.
+        if entry.get("run_type") == "aggregate" and entry.get("aggregate_name") != "median":
+            continue
+
+        name = entry.get("run_name", entry["name"])
+        times[name] = entry["real_time"] * UNIT_NANOSECONDS[entry.get("time_unit", "ns")]
+
+    return times
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative change reported as a regression or improvement (default: 0.10)")
+    parser.add_argument("--fail-on-regression", action="store_true")
+    arguments = parser.parse_args()
+
+    baseline = load(arguments.baseline)
+    current = load(arguments.current)
+    regressions = 0
+    width = max((len(name) for name in current), default=9)
+
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'current':>12}  {'ratio':>7}")
+
+    for name, time in current.items():
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>12}  {format_time(time):>12}  {'new':>7}")
+            continue
+
+        ratio = time / baseline[name] if baseline[name] > 0 else float("inf")
+        flag = ""
+
+        if ratio > 1 + arguments.threshold:
+            flag = "  slower"
+            regressions += 1
+        elif ratio < 1 - arguments.threshold:
+            flag = "  faster"
+
+        print(f"{name:<{width}}  {format_time(baseline[name]):>12}  {format_time(time):>12}  {ratio:>7.3f}{flag}")
+
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<{width}}  {format_time(baseline[name]):>12}  {'-':>12}  {'missing':>7}")
+
+    print(f"{regressions} benchmark(s) slower than the baseline by more than {arguments.threshold:.0%}")
+
+    return 1 if arguments.fail_on_regression and regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
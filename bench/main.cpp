@@ -0,0 +1,236 @@
+#include <benchmark/benchmark.h>
+#include "BenchmarkGraphs.hpp"
+#include "GeneticAlgorithm.hpp"
+#include "GraphGenerator.hpp"
+#include "TripleRomanDomination.hpp"
+#include "util_functions.hpp"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+
+// Micro-benchmarks of the hot functions of the genetic algorithm. Every benchmark runs once per graph of the matrix
+// in `BenchmarkGraphs.hpp` and is named `<function>/<graph>`. Benchmarks that need a fresh input copy it inside the
+// timed loop; `chromosomeCopy` measures that copy alone.
+
+// Gives the benchmarks access to the private operators of `GeneticAlgorithm`, on a population created with the
+// combined heuristic, as in the application.
+
+struct GeneticAlgorithmBenchmark {
+    static constexpr size_t population_size {100};
+
+    static std::unique_ptr<GeneticAlgorithm> createAlgorithm(const CSRGraph& graph) {
+        auto algorithm { std::make_unique<GeneticAlgorithm>(graph, population_size, graph.getOrder(), 1, 0.4043f,
+            0.4095f, 0.5362f, 9, 1) };
+
+        algorithm->initialize(TripleRomanDomination::getHeuristics(), 4);
+        setRandomSeed(1);
+
+        return algorithm;
+    }
+
+    static void crossOver(benchmark::State& state, size_t index, bool two_point) {
+        const BenchmarkGraph& fixture { benchmarkGraph(index) };
+        auto algorithm { createAlgorithm(fixture.graph) };
+        const auto& population { algorithm->population };
+        Chromosome offspring(fixture.graph.getOrder());
+        size_t i {0};
+
+        for (auto _ : state) {
+            const Chromosome& parent1 { population[i % population_size] };
+            const Chromosome& parent2 { population[(7 * i + 3) % population_size] };
+
+            benchmark::DoNotOptimize(two_point ? algorithm->twoPointCrossOver(parent1, parent2, offspring) :
+                algorithm->onePointCrossOver(parent1, parent2, offspring));
+            ++i;
+        }
+    }
+
+    static void mutation(benchmark::State& state, size_t index, bool constant) {
+        const BenchmarkGraph& fixture { benchmarkGraph(index) };
+        auto algorithm { createAlgorithm(fixture.graph) };
+        Chromosome individual { algorithm->population.front() };
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(constant ? algorithm->mutation1(individual) : algorithm->mutation2(individual));
+        }
+    }
+
+    static void tournamentSelection(benchmark::State& state, size_t index) {
+        const BenchmarkGraph& fixture { benchmarkGraph(index) };
+        auto algorithm { createAlgorithm(fixture.graph) };
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(algorithm->tournamentSelection(algorithm->population, 9));
+        }
+    }
+};
+
+namespace {
+
+void chromosomeCopy(benchmark::State& state, size_t index) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+    Chromosome work { fixture.feasible_solution };
+
+    for (auto _ : state) {
+        work = fixture.random_labels;
+        benchmark::DoNotOptimize(work.genes.data());
+    }
+}
+
+void feasibleSolution(benchmark::State& state, size_t index) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(feasible(fixture.graph, fixture.feasible_solution.genes));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fixture.graph.getOrder());
+}
+
+void fullFeasibilityCheck(benchmark::State& state, size_t index) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+    Chromosome work { fixture.random_labels };
+
+    for (auto _ : state) {
+        work = fixture.random_labels;
+        benchmark::DoNotOptimize(feasibilityCheck(fixture.graph, work));
+    }
+
+    state.SetItemsProcessed(state.iterations() * fixture.graph.getOrder());
+}
+
+void decreaseAllLabels(benchmark::State& state, size_t index) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+    Chromosome repaired { fixture.random_labels };
+    feasibilityCheck(fixture.graph, repaired);
+
+    Chromosome work { repaired };
+
+    for (auto _ : state) {
+        work = repaired;
+        decreaseLabels(fixture.graph, work);
+        benchmark::DoNotOptimize(work.fitness);
+    }
+
+    state.SetItemsProcessed(state.iterations() * fixture.graph.getOrder());
+}
+
+void heuristic(benchmark::State& state, size_t index, size_t chosen) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+    const auto heuristics { TripleRomanDomination::getHeuristics() };
+    setRandomSeed(1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(heuristics[chosen](fixture.graph));
+    }
+}
+
+// writes the graph as an edge list (and, with `binary`, as a `.trdg` cache) to a temporary file that is loaded in
+// the timed loop; the bundled graph is loaded from its own file.
+void loadGraph(benchmark::State& state, size_t index, bool binary) {
+    const BenchmarkGraph& fixture { benchmarkGraph(index) };
+    const auto directory { std::filesystem::temp_directory_path() };
+    std::string filename { index == 0 && !binary ? bundledGraphFile() :
+        (directory / ("trd-bench-" + fixture.name + (binary ? ".trdg" : ".txt"))).string() };
+
+    if (binary) {
+        fixture.graph.save(filename);
+    }
+
+    else if (index != 0) {
+        std::ofstream file(filename);
+
+        for (size_t vertex {0}; vertex < fixture.graph.getOrder(); ++vertex) {
+            for (size_t neighbor : fixture.graph.getAdjacencyList(vertex)) {
+                if (vertex < neighbor) {
+                    file << vertex << ' ' << neighbor << '\n';
+                }
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        CSRGraph graph(filename);
+        benchmark::DoNotOptimize(graph.getSize());
+    }
+
+    state.SetItemsProcessed(state.iterations() * fixture.graph.getSize());
+
+    if (index != 0 || binary) {
+        std::filesystem::remove(filename);
+    }
+}
+
+void generateGraph(benchmark::State& state, const std::function<CSRGraph(uint64_t)>& generator) {
+    uint64_t seed {0};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(generator(++seed).getSize());
+    }
+}
+
+template <typename Function>
+void registerForEachGraph(const std::string& family, Function function) {
+    for (size_t index {0}; index < benchmarkGraphCount(); ++index) {
+        benchmark::RegisterBenchmark((family + "/" + benchmarkGraphName(index)).c_str(), function, index);
+    }
+}
+
+void registerBenchmarks() {
+    registerForEachGraph("chromosomeCopy", chromosomeCopy);
+    registerForEachGraph("feasible", feasibleSolution);
+    registerForEachGraph("feasibilityCheck", fullFeasibilityCheck);
+    registerForEachGraph("decreaseLabels", decreaseAllLabels);
+
+    for (size_t chosen {0}; chosen < 3; ++chosen) {
+        registerForEachGraph("heuristic" + std::to_string(chosen + 1),
+            [chosen](benchmark::State& state, size_t index) { heuristic(state, index, chosen); });
+    }
+
+    registerForEachGraph("onePointCrossOver",
+        [](benchmark::State& state, size_t index) { GeneticAlgorithmBenchmark::crossOver(state, index, false); });
+    registerForEachGraph("twoPointCrossOver",
+        [](benchmark::State& state, size_t index) { GeneticAlgorithmBenchmark::crossOver(state, index, true); });
+    registerForEachGraph("mutation1",
+        [](benchmark::State& state, size_t index) { GeneticAlgorithmBenchmark::mutation(state, index, true); });
+    registerForEachGraph("mutation2",
+        [](benchmark::State& state, size_t index) { GeneticAlgorithmBenchmark::mutation(state, index, false); });
+    registerForEachGraph("tournamentSelection", GeneticAlgorithmBenchmark::tournamentSelection);
+
+    registerForEachGraph("loadEdgeList",
+        [](benchmark::State& state, size_t index) { loadGraph(state, index, false); });
+    registerForEachGraph("loadBinary",
+        [](benchmark::State& state, size_t index) { loadGraph(state, index, true); });
+
+    for (size_t order : {1000, 10000}) {
+        const std::string suffix { "/" + std::to_string(order) };
+
+        benchmark::RegisterBenchmark(("generateGnp" + suffix + "-sparse").c_str(), generateGraph,
+            [order](uint64_t seed) { return generateErdosRenyiGraph(order, 4.0 / (order - 1), seed); });
+        benchmark::RegisterBenchmark(("generateBarabasiAlbert" + suffix).c_str(), generateGraph,
+            [order](uint64_t seed) { return generateBarabasiAlbertGraph(order, 2, seed); });
+        benchmark::RegisterBenchmark(("generateGeometric" + suffix).c_str(), generateGraph,
+            [order](uint64_t seed) { return generateGeometricGraph(order, std::sqrt(4.0 / (3.14159 * order)), seed); });
+    }
+
+    benchmark::RegisterBenchmark("generateGnp/1000-dense", generateGraph,
+        [](uint64_t seed) { return generateErdosRenyiGraph(1000, 0.5, seed); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    registerBenchmarks();
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Graph.hpp"
+#include "MappedFile.hpp"
+
+class CSRGraph {
+public:
+    class Neighborhood {
+    private:
+        const size_t* first;
+        const size_t* last;
+
+    public:
+        Neighborhood(const size_t* first, const size_t* last): first(first), last(last) {}
+
+        const size_t* begin() const { return first; }
+        const size_t* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+private:
+    size_t order {0};
+    size_t size {0};
+    size_t min_degree {0};
+    size_t max_degree {0};
+
+    // the arrays live either in the vectors below or in a mapped binary cache; the pointers refer to whichever
+    // one holds them.
+    std::vector<size_t> offsets_storage {0};
+    std::vector<size_t> neighbors_storage;
+    std::vector<size_t> external_ids_storage;
+    std::shared_ptr<const MappedFile> mapping;
+
+    const size_t* offsets {nullptr};
+    const size_t* neighbors {nullptr};
+    const size_t* external_ids {nullptr};
+
+    // optional edge-membership index, see `buildEdgeIndex`.
+    std::vector<uint64_t> adjacency_matrix;
+    size_t words_per_row {0};
+    bool sorted_adjacency {false};
+
+    void bindStorage();
+    void computeDegreeBounds();
+    void buildAdjacency(std::vector<std::vector<size_t>>& endpoints);
+    void loadEdgeList(const MappedFile& file, size_t threads);
+    void loadBinary(std::shared_ptr<const MappedFile> file);
+
+public:
+    explicit CSRGraph(const Graph& graph);
+    explicit CSRGraph(const std::string& filename, size_t threads = 1);
+    CSRGraph(size_t order, std::vector<size_t> endpoints);
+
+    CSRGraph() { bindStorage(); }
+    CSRGraph(const CSRGraph& graph);
+    CSRGraph(CSRGraph&& graph) = default;
+    CSRGraph& operator=(const CSRGraph& graph);
+    CSRGraph& operator=(CSRGraph&& graph) = default;
+    ~CSRGraph() = default;
+
+    void save(const std::string& filename) const;
+
+    static bool isBinaryFile(const std::string& filename);
+
+    size_t getOrder() const { return order; }
+    size_t getSize() const { return size; }
+    size_t getMinDegree() const { return min_degree; }
+    size_t getMaxDegree() const { return max_degree; }
+
+    size_t getVertexDegree(size_t vertex) const { return offsets[vertex + 1] - offsets[vertex]; }
+
+    Neighborhood getAdjacencyList(size_t vertex) const {
+        return Neighborhood(neighbors + offsets[vertex], neighbors + offsets[vertex + 1]);
+    }
+
+    size_t getExternalId(size_t vertex) const { return external_ids[vertex]; }
+
+    size_t getVertex(size_t external_id) const;
+
+    void buildEdgeIndex();
+
+    bool hasEdgeIndex() const { return sorted_adjacency || !adjacency_matrix.empty(); }
+
+    bool edgeExists(size_t u, size_t v) const;
+
+    std::vector<size_t> componentLabels(size_t threads = 1) const;
+
+    std::vector<std::pair<size_t, size_t>> connectedComponents(size_t threads = 1) const;
+
+    std::vector<std::vector<size_t>> components(size_t threads = 1) const;
+
+    CSRGraph subgraph(const std::vector<size_t>& vertices) const;
+
+    friend std::ostream& operator<< (std::ostream& os, const CSRGraph& graph);
+};
+
+#endif
@@ -4,25 +4,53 @@
 #include <iostream>
 #include <random>
 #include <vector>
+#include <cstdint>
 #include "Graph.hpp"
+#include "CSRGraph.hpp"
+
+struct NeighborhoodWeight {
+    uint32_t label_sum {0};
+    uint32_t active {0};
+    uint32_t neighbors_2 {0};
+    uint32_t neighbors_3 {0};
+    uint32_t neighbors_4 {0};
+};
+
+// cada rótulo {0, 1, 2, 3, 4} ocupa um byte, e não um `int`.
+using Gene = uint8_t;
 
 struct Chromosome {
-    std::vector<int> genes;
+    static constexpr Gene unlabeled {0xFF};
+
+    std::vector<Gene> genes;
     size_t fitness;
+    std::vector<NeighborhoodWeight> neighborhood;
 
     Chromosome() = default;
 
-    Chromosome(const std::vector<int>& genes);
+    Chromosome(const std::vector<Gene>& genes);
 
     Chromosome(size_t genes_size);
 
-    Chromosome(const std::vector<int>& first_half, const std::vector<int>& second_half);
+    Chromosome(const std::vector<Gene>& first_half, const std::vector<Gene>& second_half);
 
     Chromosome(const Chromosome& chromosome);
+
+    Chromosome(Chromosome&& chromosome) = default;
 	
     ~Chromosome() = default;
 	
     Chromosome& operator=(const Chromosome& chromosome);
+
+    Chromosome& operator=(Chromosome&& chromosome) = default;
+
+    void setGene(const CSRGraph& graph, size_t vertex, int label);
+
+    void buildNeighborhoodCache(const CSRGraph& graph);
+
+    void clearNeighborhoodCache();
+
+    bool hasNeighborhoodCache() const;
 	
     friend std::ostream& operator<<(std::ostream& os, const Chromosome& chromosome);
 };
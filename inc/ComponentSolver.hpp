@@ -0,0 +1,64 @@
+#ifndef COMPONENT_SOLVER_HPP
+#define COMPONENT_SOLVER_HPP
+
+#include <vector>
+#include "CSRGraph.hpp"
+#include "Chromosome.hpp"
+#include "GeneticAlgorithm.hpp"
+#include "util_functions.hpp"
+
+// resultado de uma execução de `ComponentSolver::solve`, já reunido para o grafo inteiro.
+
+struct ComponentSolution {
+    std::vector<Gene> solution;
+    size_t best_fitness;
+    float fitness_mean;
+    float fitness_std;
+    PopulationDiversity initial_diversity;
+};
+
+// Resolve o PDRT separadamente em cada componente conexa do grafo: o peso de uma FDRT é a soma dos pesos das suas
+// restrições às componentes, e uma FDRT ótima do grafo é a união de FDRTs ótimas das componentes. Componentes com até
+// `exact_order` vértices são resolvidas de forma exata, uma única vez, na construção, explorando no máximo
+// `exact_node_limit` nós cada; as demais, e as pequenas cujo ótimo não foi comprovado dentro desse limite, recebem, a
+// cada chamada de `solve`, um algoritmo genético próprio.
+
+class ComponentSolver {
+private:
+    struct Component {
+        CSRGraph subgraph;
+        std::vector<size_t> vertices;
+    };
+
+    std::vector<Component> components;
+    std::vector<size_t> large_components;
+    std::vector<Gene> exact_solution;
+    size_t exact_fitness {0};
+
+    size_t population_size;
+    size_t generations;
+    float elitism_rate;
+    float crossover_rate;
+    float mutation_rate;
+    float tournament_population_size;
+    size_t threads;
+    LocalSearchSettings local_search;
+
+public:
+    ComponentSolver(const CSRGraph& graph, size_t population_size, size_t generations, float elitism_rate,
+        float crossover_rate, float mutation_rate, float tournament_population_size, size_t threads = 1,
+        size_t exact_order = 10, size_t exact_node_limit = 1000000);
+
+    size_t getComponentCount() const { return components.size(); }
+    size_t getLargeComponentCount() const { return large_components.size(); }
+
+    // busca local memética usada pelo algoritmo genético de cada componente grande.
+    void setLocalSearch(const LocalSearchSettings& settings) { local_search = settings; }
+
+    ComponentSolution solve(uint64_t seed, short int heuristic, bool flag_elitism, bool flag_selection,
+        bool flag_crossover, bool flag_mutation) const;
+
+    static bool solveExactly(const CSRGraph& graph, size_t node_limit, std::vector<Gene>& labeling);
+};
+
+#endif
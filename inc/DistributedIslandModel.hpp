@@ -0,0 +1,63 @@
+#ifndef DISTRIBUTED_ISLAND_MODEL_HPP
+#define DISTRIBUTED_ISLAND_MODEL_HPP
+
+#include <functional>
+#include <tuple>
+#include <vector>
+#include "GeneticAlgorithm.hpp"
+#include "IslandModel.hpp"
+#include "Transport.hpp"
+
+// Modelo de ilhas em que cada processo de `transport` é uma ilha. As migrações seguem as mesmas regras de
+// `IslandModel`, e os imigrantes trafegam com dois rótulos por byte. Com a mesma semente, P processos dão o mesmo
+// resultado que `IslandModel` com P ilhas.
+
+class DistributedIslandModel {
+private:
+    Transport& transport;
+    const CSRGraph& graph;
+    GeneticAlgorithm genetic_algorithm;
+
+    size_t generations;
+    size_t migration_interval;
+    size_t migrants;
+    MigrationTopology topology;
+    Xoshiro256 random_state;
+
+    std::vector<std::vector<size_t>> sources;
+    std::vector<Chromosome> emigrants;
+    std::vector<Chromosome> immigrants;
+    std::vector<uint8_t> outgoing;
+    std::vector<std::vector<uint8_t>> incoming;
+
+    std::vector<Gene> best_solution;
+    size_t best_fitness {0};
+    float fitness_mean {0};
+    float fitness_std {0};
+    PopulationDiversity initial_diversity {0, 0.0f};
+
+    void migrate();
+    void gatherResults(const std::tuple<size_t, float, float>& statistics);
+
+public:
+    DistributedIslandModel(Transport& transport, const CSRGraph& graph, size_t population_size, size_t genes_size,
+        size_t generations, float elitism_rate, float crossover_rate, float mutation_rate,
+        size_t tournament_population_size, uint64_t seed, size_t migration_interval, size_t migrants,
+        MigrationTopology topology);
+
+    DistributedIslandModel(const DistributedIslandModel&) = delete;
+    DistributedIslandModel& operator=(const DistributedIslandModel&) = delete;
+
+    std::vector<Gene> getBestSolution();
+    size_t getBestFitness();
+    float getFitnessMean();
+    float getFitnessSTD();
+    PopulationDiversity getInitialDiversity();
+
+    void setLocalSearch(const LocalSearchSettings& settings);
+
+    std::tuple<size_t, float, float> run(std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics,
+        size_t chosen_heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef EXACT_SOLVER_HPP
+#define EXACT_SOLVER_HPP
+
+#include <vector>
+#include "CSRGraph.hpp"
+#include "Chromosome.hpp"
+#include "LowerBounds.hpp"
+
+// Resolvedor exato do PDRT por branch-and-bound, sem dependências externas. Cada componente conexa é resolvida
+// separadamente, com conjuntos de vértices em bitsets, uma regra de redução na raiz e, em cada nó, um limite inferior
+// dado por relaxação lagrangiana, que na raiz parte da de `LowerBounds`; subproblemas que se separam em partes
+// independentes são resolvidos parte a parte. O número de nós cresce exponencialmente com a diferença entre o ótimo e
+// esse limite, que em G(n, p) esparsos é de cerca de 10% do ótimo: com cerca de 100 vértices eles já precisam da ordem
+// de 10^6 nós. Com `node_limit` > 0, a busca em cada componente para após esse número de nós; a solução devolvida
+// continua viável, mas pode não ser ótima.
+
+class ExactSolver {
+private:
+    const CSRGraph& graph;
+    size_t node_limit;
+    const LowerBounds* bounds;
+
+    std::vector<Gene> solution;
+    size_t weight {0};
+    size_t lower_bound {0};
+    size_t nodes {0};
+    bool optimal {false};
+
+public:
+    // `bounds`, se dado, deve ser do mesmo grafo; sem ele, os limites são calculados em `solve`.
+    explicit ExactSolver(const CSRGraph& graph, size_t node_limit = 0, const LowerBounds* bounds = nullptr);
+
+    bool solve();
+
+    const std::vector<Gene>& getSolution() const { return solution; }
+    size_t getWeight() const { return weight; }
+    size_t getLowerBound() const { return lower_bound; }
+    size_t getNodeCount() const { return nodes; }
+    bool isOptimal() const { return optimal; }
+};
+
+#endif
@@ -6,58 +6,127 @@
 #include <vector>
 #include <functional>
 #include <tuple>
+#include <memory>
+#include <chrono>
 #include "Chromosome.hpp"
 #include "util_functions.hpp"
+#include "ThreadPool.hpp"
+#include "Profile.hpp"
+
+// critério que encerrou a evolução; `generations` quando todas as gerações pedidas foram executadas.
+
+enum class StopReason { generations, stagnation, lower_bound, time_limit, evaluations };
+
+const char* stopReasonName(StopReason reason);
+
+// critérios de parada antecipada, verificados antes de cada geração; o valor 0 desativa o critério.
+// - stagnation_generations: gerações seguidas sem melhora do melhor fitness;
+// - lower_bound: um limite inferior do peso ótimo, que encerra a busca quando é alcançado;
+// - time_limit: tempo, em segundos, desde a criação da população inicial;
+// - max_evaluations: número de indivíduos avaliados, contando a população inicial e cada filho gerado.
+
+struct StoppingCriteria {
+    size_t stagnation_generations {0};
+    size_t lower_bound {0};
+    double time_limit {0.0};
+    size_t max_evaluations {0};
+};
+
+// busca local memética (`localSearch`) aplicada à prole: em cada geração múltipla de `interval`, cada filho passa 
+// pela busca com probabilidade `rate`, avaliando no máximo `budget` movimentos (0: sem limite). Com `rate` 0, a 
+// etapa fica desativada.
+
+struct LocalSearchSettings {
+    float rate {0.0f};
+    size_t budget {0};
+    size_t interval {1};
+};
 
 class GeneticAlgorithm {
+	// os micro-benchmarks de `bench/` chamam os operadores diretamente; por isso eles não são `inline`.
+	friend struct GeneticAlgorithmBenchmark;
+	
 	private:
 		size_t population_size;
 		size_t genes_size;
 		std::vector<Chromosome> population;
+		std::vector<Chromosome> next_population;
+		std::vector<size_t> ranking;
 	    size_t generations;
-        Graph graph;
-        std::vector<int> best_solution;
+        const CSRGraph& graph;
+        Chromosome best_solution;
         float best_fitness;
         float fitness_mean;
         float fitness_std;
+        PopulationDiversity initial_diversity;
         
         float elitism_rate;
         float crossover_rate;
         float mutation_rate;
         size_t tournament_population_size;
+        uint64_t seed;
+        Xoshiro256 random_state;
+        size_t generation;
+        bool has_population;
+        std::unique_ptr<ThreadPool> pool;
+        
+        StoppingCriteria stopping_criteria;
+        LocalSearchSettings local_search;
+        StopReason stop_reason;
+        size_t evaluations;
+        size_t last_improvement;
+        std::chrono::steady_clock::time_point start_time;
+        
+        // com TRD_INSTRUMENTATION, os tempos e contadores de cada geração; a posição 0 é a da população inicial.
+        Profile profile;
+        std::vector<ProfileSnapshot> generation_profiles;
+        std::chrono::steady_clock::time_point profile_start;
+        
+        inline bool shouldStop();
+        
+        inline void recordProfile();
 
 
-		inline void createPopulation(std::vector<std::function<Chromosome(const Graph&)>> generateChromosomeHeuristics,
-		 	const Graph& graph, size_t heuristic);
+		inline void createPopulation(std::vector<std::function<Chromosome(const CSRGraph&)>> generateChromosomeHeuristics,
+		 	const CSRGraph& graph, size_t heuristic);
 	
         inline std::vector<Chromosome>& createNewPopulation(bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);    
         
-     	inline void elitism(std::vector<Chromosome>& population, float elitism_rate);	
+     	inline size_t elitism(const std::vector<Chromosome>& population, std::vector<Chromosome>& next_population, float elitism_rate);	
      	
-     	inline void elitismClones(std::vector<Chromosome>& population, float elitism_rate);	
+     	inline size_t elitismClones(const std::vector<Chromosome>& population, std::vector<Chromosome>& next_population, float elitism_rate);	
+        
+		inline void swapGeneRange(Chromosome& chromosome1, Chromosome& chromosome2, size_t first, size_t last, 
+			std::vector<size_t>& changed_vertices);
         
-		inline Chromosome onePointCrossOver(const Chromosome& chromosome1, const Chromosome& cromossomo2); 
+		inline Chromosome& crossOverRange(const Chromosome& chromosome1, const Chromosome& chromosome2, size_t first, size_t last,
+			Chromosome& offspring);
+        
+		Chromosome& onePointCrossOver(const Chromosome& chromosome1, const Chromosome& cromossomo2, Chromosome& offspring); 
                 	
-    	inline Chromosome twoPointCrossOver(const Chromosome& chromosome1, const Chromosome& cromossomo2);
+    	Chromosome& twoPointCrossOver(const Chromosome& chromosome1, const Chromosome& cromossomo2, Chromosome& offspring);
                 	
-        inline Chromosome& mutation1(Chromosome& chromosome);
+        Chromosome& mutation1(Chromosome& chromosome);
         
-        inline Chromosome& mutation2(Chromosome& chromosome);
+        Chromosome& mutation2(Chromosome& chromosome);
         
-		inline const Chromosome& tournamentSelection(const std::vector<Chromosome>& population, size_t individuals_size);
+		const Chromosome& tournamentSelection(const std::vector<Chromosome>& population, size_t individuals_size);
 		
 		inline static Chromosome& chooseBestSolution(Chromosome& chromosome1, Chromosome& chromosome2);
 		
-		inline Chromosome findBestSolution(const std::vector<Chromosome>& population); 
+		inline const Chromosome& findBestSolution(const std::vector<Chromosome>& population); 
 
 	public:
-		GeneticAlgorithm(Graph& graph, size_t population_size, size_t genes_size, size_t generations,
-			float elitism_rate, float crossover_rate, float mutation_rate, size_t tournament_population_size):
+		GeneticAlgorithm(const CSRGraph& graph, size_t population_size, size_t genes_size, size_t generations,
+			float elitism_rate, float crossover_rate, float mutation_rate, size_t tournament_population_size, uint64_t seed, size_t threads = 1):
 			  population_size(population_size), genes_size(genes_size), 
 			  population(population_size), generations(generations), 
-			  graph(graph), best_solution(), fitness_mean(0), fitness_std(0.0),
+			  graph(graph), best_solution(), best_fitness(0), fitness_mean(0), fitness_std(0.0), initial_diversity{0, 0.0f},
 	  		  elitism_rate(elitism_rate), crossover_rate(crossover_rate),
-	  		  mutation_rate(mutation_rate), tournament_population_size(tournament_population_size) {}               
+	  		  mutation_rate(mutation_rate), tournament_population_size(tournament_population_size),
+	  		  seed(seed), random_state(seed), generation(0), has_population(false), 
+	  		  pool(std::make_unique<ThreadPool>(threads)), stop_reason(StopReason::generations), evaluations(0), 
+	  		  last_improvement(0) {}               
 
 		~GeneticAlgorithm() {}
 		
@@ -69,9 +138,33 @@ class GeneticAlgorithm {
 
 		size_t getFitnessSTD();
 		
-        std::vector<int> getBestSolution();		      
+        std::vector<Gene> getBestSolution();		      
+        
+        PopulationDiversity getInitialDiversity();
+        
+        size_t getCurrentGeneration();
+        
+        bool hasPopulation();
+        
+        void setStoppingCriteria(const StoppingCriteria& criteria);
+        
+        void setLocalSearch(const LocalSearchSettings& settings);
+        
+        StopReason getStopReason();
+        
+        size_t getEvaluations();
+        
+        const std::vector<ProfileSnapshot>& getGenerationProfiles();
+        
+        void initialize(std::vector<std::function<Chromosome(const CSRGraph&)>>, size_t chosen_heuristic);
+        
+        std::tuple<size_t, float, float> evolve(size_t generations, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);
+        
+        void getBestIndividuals(size_t count, std::vector<Chromosome>& individuals);
+        
+        void replaceWorstIndividuals(const std::vector<Chromosome>& individuals);
         
-        std::tuple<size_t, float, float> run(size_t generations, std::vector<std::function<Chromosome(const Graph&)>>, size_t chosen_heuristic,
+        std::tuple<size_t, float, float> run(size_t generations, std::vector<std::function<Chromosome(const CSRGraph&)>>, size_t chosen_heuristic,
         		bool flag_elitism, bool flag_selection , bool flag_crossover , bool flag_mutation);
 };	
 
@@ -9,6 +9,7 @@
 #include <vector>
 #include <sstream>
 #include <fstream>
+#include <cstdint>
 
 class Graph {
 private:
@@ -18,13 +19,11 @@ private:
     std::unordered_map<size_t, std::vector<size_t>> adjList;
     void addVertex(size_t source);
     void addEdge(size_t source, size_t destination);
-    void DFSVisit(size_t u, std::vector<bool>& discovered, size_t& numberOfVertices, size_t& minDegree);
     size_t computeMaxVertexDegree() const;
     size_t computeMinVertexDegree() const;
     
 public:	
     Graph(const std::string& filename);
-    Graph(size_t order, float probabilityOfEdge);
     Graph(size_t order);	
     Graph(const Graph& graph);
 
@@ -0,0 +1,16 @@
+#ifndef GRAPH_GENERATOR_HPP
+#define GRAPH_GENERATOR_HPP
+
+#include <cstdint>
+#include "CSRGraph.hpp"
+
+// Random graph models. Every generator runs in expected O(n + m), draws from its own generator seeded with
+// `seed`, and never produces self-loops or parallel edges.
+
+CSRGraph generateErdosRenyiGraph(size_t order, double probability, uint64_t seed);
+
+CSRGraph generateBarabasiAlbertGraph(size_t order, size_t attachment, uint64_t seed);
+
+CSRGraph generateGeometricGraph(size_t order, double radius, uint64_t seed);
+
+#endif
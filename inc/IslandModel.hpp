@@ -0,0 +1,64 @@
+#ifndef ISLAND_MODEL_HPP
+#define ISLAND_MODEL_HPP
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "GeneticAlgorithm.hpp"
+#include "ThreadPool.hpp"
+
+// ilhas de onde cada ilha recebe imigrantes: a anterior no anel, todas as outras, ou uma sorteada a cada migração.
+
+enum class MigrationTopology { ring, full, random };
+
+void chooseMigrationSources(MigrationTopology topology, size_t islands, Xoshiro256& random_state,
+    std::vector<std::vector<size_t>>& sources);
+
+// Modelo de ilhas: `islands` populações evoluem de forma independente, cada uma com seu próprio algoritmo genético,
+// e a cada `migration_interval` gerações os `migrants` melhores indivíduos de cada ilha substituem os piores das
+// ilhas vizinhas na topologia escolhida.
+
+class IslandModel {
+private:
+    std::vector<std::unique_ptr<GeneticAlgorithm>> islands;
+    std::vector<std::vector<Chromosome>> outboxes;
+    std::vector<std::vector<Chromosome>> inboxes;
+    std::vector<std::vector<size_t>> sources;
+
+    size_t generations;
+    size_t migration_interval;
+    size_t migrants;
+    MigrationTopology topology;
+    Xoshiro256 random_state;
+    ThreadPool pool;
+
+    std::vector<Gene> best_solution;
+    size_t best_fitness {0};
+    float fitness_mean {0};
+    float fitness_std {0};
+    PopulationDiversity initial_diversity {0, 0.0f};
+
+    void migrate();
+
+public:
+    IslandModel(const CSRGraph& graph, size_t islands, size_t population_size, size_t genes_size, size_t generations,
+        float elitism_rate, float crossover_rate, float mutation_rate, size_t tournament_population_size, uint64_t seed,
+        size_t migration_interval, size_t migrants, MigrationTopology topology, size_t threads = 1);
+
+    IslandModel(const IslandModel&) = delete;
+    IslandModel& operator=(const IslandModel&) = delete;
+
+    std::vector<Gene> getBestSolution();
+    size_t getBestFitness();
+    float getFitnessMean();
+    float getFitnessSTD();
+    PopulationDiversity getInitialDiversity();
+
+    void setLocalSearch(const LocalSearchSettings& settings);
+
+    std::tuple<size_t, float, float> run(std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics,
+        size_t chosen_heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);
+};
+
+#endif
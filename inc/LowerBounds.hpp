@@ -0,0 +1,36 @@
+#ifndef LOWER_BOUNDS_HPP
+#define LOWER_BOUNDS_HPP
+
+#include <vector>
+#include "CSRGraph.hpp"
+
+// Limites inferiores do peso de uma FDRT ótima, calculados uma única vez na construção e guardados para todas as
+// execuções sobre o mesmo grafo. Cada componente conexa recebe o maior de dois limites, e o limite do grafo é a soma
+// dos das componentes:
+// - sequência de graus: quanto um vértice com rótulo l pode cobrir depende só do seu grau, então o peso mínimo para
+//   cobrir 3 unidades em cada vértice, usando os graus da componente, já é um limite; ele generaliza ceil(4n / (Δ + 1));
+// - relaxação: a relaxação lagrangiana das restrições de cobertura, melhorada por passos de subgradiente, que tem a
+//   força da relaxação linear.
+
+class LowerBounds {
+private:
+    size_t degree_sequence_bound {0};
+    size_t relaxation_bound {0};
+    size_t bound {0};
+    std::vector<size_t> component_bounds;
+    std::vector<double> multipliers;
+
+public:
+    explicit LowerBounds(const CSRGraph& graph, size_t threads = 1);
+
+    size_t getDegreeSequenceBound() const { return degree_sequence_bound; }
+    size_t getRelaxationBound() const { return relaxation_bound; }
+    size_t getBound() const { return bound; }
+    const std::vector<size_t>& getComponentBounds() const { return component_bounds; }
+
+    // multiplicadores da relaxação que deram `getRelaxationBound`, um por vértice; 0 nos vértices que a redução das
+    // folhas já fixou ou cobriu. O `ExactSolver` parte deles.
+    const std::vector<double>& getMultipliers() const { return multipliers; }
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+
+// Read-only memory mapping of a whole file. The mapping lives as long as the object.
+
+class MappedFile {
+private:
+    const char* bytes;
+    size_t length;
+
+public:
+    explicit MappedFile(const std::string& filename);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Phases timed by the instrumentation. Phases nest: `crossover` and `mutation` include their `repair`, and
+// `crossover` includes the `copy` of the parents into the offspring.
+
+enum class Phase : size_t { seeding, selection, crossover, copy, mutation, repair, local_search, elitism, statistics };
+
+constexpr size_t phase_count {9};
+
+// Event counters: calls to `feasibilityCheck`, labels it raised, and single-vertex `feasible` checks.
+
+enum class Counter : size_t { repair_calls, repaired_labels, feasible_calls };
+
+constexpr size_t counter_count {3};
+
+const char* phaseName(Phase phase);
+
+const char* counterName(Counter counter);
+
+// Totals of a profile. `elapsed_nanoseconds` is the wall-clock time of the measured span, filled by the owner of the
+// profile, so that the time spent outside the instrumented phases can be told apart.
+
+struct ProfileSnapshot {
+    uint64_t elapsed_nanoseconds {0};
+    std::array<uint64_t, phase_count> nanoseconds {};
+    std::array<uint64_t, phase_count> calls {};
+    std::array<uint64_t, counter_count> counters {};
+};
+
+/**
+ * @brief Totals of the instrumented phases and counters, safe to update from several threads.
+ *
+ * Threads never touch it on every event: a `ProfileScope` collects the events of the current thread in a plain
+ * buffer and adds the buffer to the profile once, when the scope ends.
+ */
+
+class Profile {
+private:
+    std::array<std::atomic<uint64_t>, phase_count> nanoseconds {};
+    std::array<std::atomic<uint64_t>, phase_count> calls {};
+    std::array<std::atomic<uint64_t>, counter_count> counters {};
+
+public:
+    void add(const ProfileSnapshot& snapshot);
+
+    ProfileSnapshot snapshot() const;
+
+    void reset();
+};
+
+// Makes `profile` the destination of the events recorded on this thread until the scope ends. Scopes nest; events
+// recorded outside any scope are dropped.
+
+class ProfileScope {
+private:
+    Profile& profile;
+    ProfileSnapshot buffer;
+    ProfileSnapshot* previous;
+
+public:
+    explicit ProfileScope(Profile& profile);
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope();
+
+    static ProfileSnapshot* current();
+};
+
+// Adds the time between construction and destruction to `phase`, with one call.
+
+class PhaseTimer {
+private:
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit PhaseTimer(Phase phase) : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+    ~PhaseTimer();
+};
+
+inline void profileCount(Counter counter, uint64_t amount = 1) {
+    if (ProfileSnapshot* buffer { ProfileScope::current() }) {
+        buffer->counters[static_cast<size_t>(counter)] += amount;
+    }
+}
+
+// The macros expand to nothing unless the build defines TRD_INSTRUMENTATION (`make INSTRUMENT=1`), so the
+// instrumented code has no cost in a regular build.
+
+#define TRD_PROFILE_CONCAT_INNER(a, b) a##b
+#define TRD_PROFILE_CONCAT(a, b) TRD_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef TRD_INSTRUMENTATION
+#define TRD_PROFILE_SCOPE(profile) ProfileScope TRD_PROFILE_CONCAT(profile_scope_, __LINE__) {profile}
+#define TRD_PROFILE_PHASE(phase) PhaseTimer TRD_PROFILE_CONCAT(phase_timer_, __LINE__) {Phase::phase}
+#define TRD_PROFILE_COUNT(counter, amount) profileCount(Counter::counter, amount)
+#else
+#define TRD_PROFILE_SCOPE(profile) ((void) 0)
+#define TRD_PROFILE_PHASE(phase) ((void) 0)
+#define TRD_PROFILE_COUNT(counter, amount) ((void) 0)
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Derives the seed of an independent stream `stream` from a base seed (SplitMix64 finalizer).
+ *
+ * Streams can be derived recursively, e.g. `mixSeed(mixSeed(seed, trial), individual)`, to give every trial,
+ * thread and individual its own generator from a single user-provided seed.
+ */
+
+inline uint64_t mixSeed(uint64_t seed, uint64_t stream) {
+    uint64_t value { seed + (stream + 1) * 0x9E3779B97F4A7C15ULL };
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief xoshiro256** generator. Seeding is O(1), so a generator can be created per trial, thread or
+ * individual. Satisfies UniformRandomBitGenerator, so it works with the standard distributions and `std::shuffle`.
+ */
+
+class Xoshiro256 {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256(uint64_t seed = 0) { this->seed(seed); }
+
+    void seed(uint64_t seed) {
+        for (int i {0}; i < 4; ++i) {
+            state[i] = mixSeed(seed, i);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        const uint64_t result { rotl(state[1] * 5, 7) * 9 };
+        const uint64_t shifted { state[1] << 17 };
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef RESIDUAL_GRAPH_HPP
+#define RESIDUAL_GRAPH_HPP
+
+#include <cstdint>
+#include <vector>
+#include "CSRGraph.hpp"
+
+// Vertex-deletion view over a CSRGraph, used by the construction heuristics. Deleting a vertex only flips its alive
+// flag and decrements the degree counters of its alive neighbors, so deleting every vertex costs O(n + m) in total.
+
+class ResidualGraph {
+private:
+    const CSRGraph& graph;
+
+    std::vector<uint8_t> alive;
+    std::vector<size_t> degree;
+    std::vector<size_t> vertices;
+    std::vector<size_t> position;
+    std::vector<size_t> isolated;
+
+public:
+    explicit ResidualGraph(const CSRGraph& graph);
+
+    ResidualGraph(const ResidualGraph&) = delete;
+    ResidualGraph& operator=(const ResidualGraph&) = delete;
+
+    size_t getOrder() const { return vertices.size(); }
+    size_t getVertex(size_t index) const { return vertices[index]; }
+    size_t getVertexDegree(size_t vertex) const { return degree[vertex]; }
+    bool vertexExists(size_t vertex) const { return alive[vertex]; }
+
+    void deleteVertex(size_t vertex);
+
+    void deleteAdjacencyList(size_t vertex);
+
+    // Deletes every alive vertex left without alive neighbors, calling `visit(vertex)` for each one first.
+    template <typename Visitor>
+    void deleteIsolatedVertices(const Visitor& visit) {
+        while (!isolated.empty()) {
+            size_t vertex { isolated.back() };
+            isolated.pop_back();
+
+            if (alive[vertex]) {
+                visit(vertex);
+                deleteVertex(vertex);
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::condition_variable job_finished;
+
+    void (*invoke)(const void*, size_t);
+    const void* task;
+    size_t task_count;
+    std::atomic<size_t> next_index;
+    size_t busy_workers;
+    size_t job_id;
+    bool stopping;
+    std::exception_ptr error;
+
+    void workerLoop();
+    void runTasks();
+    void run(size_t count, void (*invoke)(const void*, size_t), const void* task);
+
+public:
+    explicit ThreadPool(size_t threads);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    size_t getThreadCount() const;
+
+    // `task` is invoked by reference, so no copy or allocation happens per call.
+    template <typename Task>
+    void parallelFor(size_t count, const Task& task) {
+        run(count, [](const void* context, size_t index) { (*static_cast<const Task*>(context))(index); }, &task);
+    }
+
+    static size_t defaultThreadCount();
+};
+
+#endif
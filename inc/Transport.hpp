@@ -0,0 +1,87 @@
+#ifndef TRANSPORT_HPP
+#define TRANSPORT_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Message passing between the processes of a distributed run. Every process has a rank in 0..size-1 and can exchange
+// byte messages with any other process.
+
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    virtual size_t getRank() const = 0;
+    virtual size_t getSize() const = 0;
+
+    // sends `message` to every rank in `destinations` and receives one message from every rank in `sources`, in the
+    // order of `sources`. Sends and receives progress together, so two ranks may exchange large messages without
+    // deadlocking.
+    virtual void exchange(const std::vector<size_t>& destinations, const std::vector<uint8_t>& message,
+        const std::vector<size_t>& sources, std::vector<std::vector<uint8_t>>& messages) = 0;
+};
+
+// Full mesh of stream sockets, either Unix domain sockets (`unix:<path>`, rank r listens on `<path>.<r>`) or TCP
+// (`tcp:<host>:<port>`, rank r listens on `<port> + r`). The processes may be started in any order: each one retries
+// its connections until the other side is listening.
+
+class SocketTransport : public Transport {
+private:
+    size_t rank;
+    size_t size;
+    std::vector<int> peers;
+    std::string socket_path;
+
+    int listen(const std::string& address);
+    int connect(const std::string& address, size_t peer);
+    void closeAll();
+
+public:
+    SocketTransport(const std::string& address, size_t rank, size_t size);
+
+    SocketTransport(const SocketTransport&) = delete;
+    SocketTransport& operator=(const SocketTransport&) = delete;
+
+    ~SocketTransport() override;
+
+    size_t getRank() const override { return rank; }
+    size_t getSize() const override { return size; }
+
+    void exchange(const std::vector<size_t>& destinations, const std::vector<uint8_t>& message,
+        const std::vector<size_t>& sources, std::vector<std::vector<uint8_t>>& messages) override;
+};
+
+#ifdef TRD_WITH_MPI
+
+// MPI_COMM_WORLD; initializes MPI on construction and finalizes it on destruction, so only one may exist.
+
+class MpiTransport : public Transport {
+private:
+    size_t rank;
+    size_t size;
+
+public:
+    MpiTransport();
+
+    MpiTransport(const MpiTransport&) = delete;
+    MpiTransport& operator=(const MpiTransport&) = delete;
+
+    ~MpiTransport() override;
+
+    size_t getRank() const override { return rank; }
+    size_t getSize() const override { return size; }
+
+    void exchange(const std::vector<size_t>& destinations, const std::vector<uint8_t>& message,
+        const std::vector<size_t>& sources, std::vector<std::vector<uint8_t>>& messages) override;
+};
+
+#endif
+
+// creates the transport named by `address`: `unix:<path>`, `tcp:<host>:<port>` or `mpi` (rank and size then come
+// from MPI, and the arguments are ignored).
+
+std::unique_ptr<Transport> createTransport(const std::string& address, size_t rank, size_t size);
+
+#endif
@@ -2,6 +2,7 @@
 #define TRIPLE_ROMAN_DOMINATION_HPP
 
 #include "Graph.hpp"
+#include "ResidualGraph.hpp"
 #include "GeneticAlgorithm.hpp"
 #include "Chromosome.hpp"
 #include "util_functions.hpp"
@@ -10,36 +11,46 @@
 
 class TripleRomanDomination {
 private:
-    Graph graph;
+    const CSRGraph& graph;
     GeneticAlgorithm genetic_algorithm;
-    std::vector<int> solution_genetic_algorithm;
+    std::vector<Gene> solution_genetic_algorithm;
     size_t genetic_algorithm_best_fitness;
     float genetic_algorithm_fitness_mean;
     float genetic_algorithm_fitness_std;
 
 public:
-    TripleRomanDomination(Graph& graph, size_t population_size, size_t genes_size, size_t generations,
+    TripleRomanDomination(const CSRGraph& graph, size_t population_size, size_t genes_size, size_t generations,
      			float elitism_rate, float crossover_rate, float mutation_rate,
-                float tournament_population_size)
-        : graph(std::move(graph)),
-          genetic_algorithm(graph, population_size, genes_size, generations, elitism_rate, crossover_rate, mutation_rate, tournament_population_size) {}
-          
-  	TripleRomanDomination() = default;
+                float tournament_population_size, uint64_t seed, size_t threads = 1)
+        : graph(graph),
+          genetic_algorithm(graph, population_size, genes_size, generations, elitism_rate, crossover_rate, mutation_rate, 
+          	tournament_population_size, seed, threads) {}
 
     ~TripleRomanDomination() = default;
 
-    Graph& getGraph();
+    const CSRGraph& getGraph();
     
-    std::vector<int> getSolutionGeneticAlgorithm();
+    std::vector<Gene> getSolutionGeneticAlgorithm();
     size_t getGeneticAlgorithmBestFitness();
     float getGeneticAlgorithmFitnessMean();
     float getGeneticAlgorithmFitnessSTD();
+    PopulationDiversity getInitialDiversity();
+    StopReason getStopReason();
+    size_t getGenerationsRun();
+    const std::vector<ProfileSnapshot>& getGenerationProfiles();
+
+    void setStoppingCriteria(const StoppingCriteria& criteria);
+    void setLocalSearch(const LocalSearchSettings& settings);
 
     void runGeneticAlgorithm(short int heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);
 
-    static Chromosome heuristic1(const Graph& graph);
-    static Chromosome heuristic2(const Graph& graph);
-    static Chromosome heuristic3(const Graph& graph);
+    void continueGeneticAlgorithm(size_t generations, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation);
+
+    static std::vector<std::function<Chromosome(const CSRGraph&)>> getHeuristics();
+
+    static Chromosome heuristic1(const CSRGraph& graph);
+    static Chromosome heuristic2(const CSRGraph& graph);
+    static Chromosome heuristic3(const CSRGraph& graph);
 };
 
 #endif
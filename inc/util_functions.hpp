@@ -3,29 +3,55 @@
 
 #include <vector>
 #include <random>
+#include <cstdint>
 #include "Graph.hpp"
+#include "CSRGraph.hpp"
 #include "Chromosome.hpp"
+#include "Random.hpp"
+
+struct PopulationDiversity {
+    size_t distinct_genomes;
+    float mean_hamming_distance;
+};
+
+void setRandomSeed(uint64_t);
+
+Xoshiro256& getRandomEngine();
 
 size_t getRandomInt(size_t, size_t); 
 
 float getRandomFloat(float, float);
 
-bool feasible(const Graph&, const std::vector<int>&);
+bool feasible(const CSRGraph&, const std::vector<Gene>&);
+
+bool feasible(const CSRGraph&, const std::vector<Gene>&, size_t);
+
+bool feasible(const CSRGraph&, const Chromosome&, size_t);
 
-bool activeNeighborhoodIsFeasible(const Graph& graph, const std::vector<int>& solution, const std::vector<int>& active_neighbors);
+void repairLabel(const CSRGraph&, Chromosome&, size_t);
 
-bool feasible(const Graph&, const std::vector<int>&, size_t);
+Chromosome& feasibilityCheck(const CSRGraph& , Chromosome&);
 
-Chromosome& feasibilityCheck(const Graph& , Chromosome&);
+Chromosome& feasibilityCheck(const CSRGraph&, Chromosome&, const std::vector<size_t>&);
 
-void decreaseLabels(const Graph&, std::vector<int>&);
+Chromosome& feasibilityCheck(const CSRGraph&, Chromosome&, size_t);
 
-void decreaseLabel(const Graph&, std::vector<int>&, size_t);
+void decreaseLabels(const CSRGraph&, Chromosome&);
+
+void decreaseLabel(const CSRGraph&, Chromosome&, size_t);
+
+size_t localSearch(const CSRGraph&, Chromosome&, size_t);
+
+size_t sumLabels(const Gene*, size_t);
 
 Chromosome& fitness(Chromosome&);
 
-int computeRightLowerBound(const Graph&, int);
+void fitnessStatistics(const std::vector<Chromosome>&, float&, float&);
+
+PopulationDiversity populationDiversity(const std::vector<Chromosome>&);
+
+int computeRightLowerBound(const CSRGraph&, int);
 
-int computeRightUpperBound(Graph&, int);
+int computeRightUpperBound(const CSRGraph&, int);
 
 #endif
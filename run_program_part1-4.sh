@@ -24,7 +24,7 @@ run_flag_test() {
 
         # Nome do arquivo de saída
         OUTPUT_FILE="$FLAG_DIR/${FLAG_NAME}_${flag_value}.csv"
-        echo "best_fitness,fitness_mean,fitness_std,elapsed_time(seconds)" > $OUTPUT_FILE
+        echo "best_fitness,fitness_mean,fitness_std,elapsed_time(seconds),generations,stop_reason,lower_bound,optimum,gap" > $OUTPUT_FILE
 
         # Executa o programa e salva a saída no arquivo CSV
         echo "Rodando com $FLAG_NAME = $flag_value"
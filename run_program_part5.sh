@@ -8,7 +8,7 @@ mkdir -p $BASE_DIR
 OUTPUT_FILE="$BASE_DIR/results.csv"
 
 # Cabeçalho do arquivo CSV
-echo "order,best_fitness,fitness_mean,fitness_std,elapsed_time(seconds)" > $OUTPUT_FILE
+echo "order,best_fitness,fitness_mean,fitness_std,elapsed_time(seconds),generations,stop_reason,lower_bound,optimum,gap" > $OUTPUT_FILE
 
 # Valores fixos para as flags (ajuste conforme necessário)
 FLAG_ELITISM=0
@@ -16,12 +16,16 @@ FLAG_SELECTION=1
 FLAG_CROSSOVER=1
 FLAG_MUTATION=0
 
+# Ordens testadas; podem ser trocadas pela variável de ambiente ORDERS, por exemplo
+# ORDERS="100 1000 10000 100000 1000000" ./run_program_part5.sh --generator=ba
+ORDERS=${ORDERS:-$(seq 10 10 100)}
+
 # Loop para incrementar a ordem
-for order in {10..100..10}; do  # Ajuste o intervalo e incremento conforme necessário
+for order in $ORDERS; do
     echo "Rodando com ordem = $order"
 
     # Executa o algoritmo e redireciona a saída para um arquivo temporário
-    ./app "" "" $FLAG_ELITISM $FLAG_SELECTION $FLAG_CROSSOVER $FLAG_MUTATION $order > temp_output.txt
+    ./app "" "" $FLAG_ELITISM $FLAG_SELECTION $FLAG_CROSSOVER $FLAG_MUTATION $order "$@" > temp_output.txt
 
     # Adiciona a ordem como a primeira coluna e salva no arquivo CSV
     awk -v order="$order" '{print order "," $0}' temp_output.txt >> $OUTPUT_FILE
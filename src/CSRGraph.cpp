@@ -0,0 +1,658 @@
+#include "CSRGraph.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+static_assert(sizeof(size_t) == sizeof(uint64_t), "the binary graph cache stores size_t as 64-bit words");
+
+// Layout of a `.trdg` binary cache: the magic, then `order`, `size`, `min_degree`, `max_degree` and the number of
+// stored neighbors as 64-bit words, then `offsets[order + 1]`, `neighbors[...]` and `external_ids[order]`, all in
+// native byte order. Every array starts 8-byte aligned, so a mapped cache is used in place.
+
+static constexpr char binary_magic[8] {'T', 'R', 'D', 'G', 'C', 'S', 'R', '1'};
+static constexpr size_t binary_header_words {5};
+static constexpr size_t binary_header_size { sizeof(binary_magic) + binary_header_words * sizeof(uint64_t) };
+
+/**
+ * @brief Builds an immutable compressed sparse row copy of a mutable graph.
+ *
+ * Vertex ids are remapped to the dense range 0..n-1 in increasing order of their original id, so
+ * graphs whose ids are already 0..n-1 keep the same numbering. The neighbors of every vertex are
+ * stored contiguously in `neighbors[offsets[v] .. offsets[v + 1])`, keeping the order of the source
+ * adjacency list.
+ *
+ * @param graph The graph built by the loader or by the random generator.
+ */
+
+CSRGraph::CSRGraph(const Graph& graph): 
+    order(graph.getOrder()), size(graph.getSize()), offsets_storage(graph.getOrder() + 1, 0) {
+
+    external_ids_storage.reserve(order);
+    
+    for (const auto& [vertex, _] : graph.getAdjacencyList()) {
+        external_ids_storage.push_back(vertex);
+    }
+    
+    std::sort(external_ids_storage.begin(), external_ids_storage.end());
+    
+    for (size_t i {0}; i < order; ++i) {
+        offsets_storage[i + 1] = offsets_storage[i] + graph.getVertexDegree(external_ids_storage[i]);
+    }
+    
+    neighbors_storage.reserve(offsets_storage[order]);
+    
+    for (size_t i {0}; i < order; ++i) {
+        for (const auto& neighbor : graph.getAdjacencyList(external_ids_storage[i])) {
+            neighbors_storage.push_back(std::lower_bound(external_ids_storage.begin(), external_ids_storage.end(), 
+                neighbor) - external_ids_storage.begin());
+        }
+    }
+    
+    bindStorage();
+    computeDegreeBounds();
+}
+
+/**
+ * @brief Loads a graph file: either a `.trdg` binary cache written by `save`, which is mapped and used in
+ * place, or a text edge list with one `source destination` pair per line.
+ *
+ * The edge list is read exactly as `Graph(const std::string&)` reads it (lines that do not start with two
+ * integers are skipped, self-loops only add their vertex), and the result is identical to building a `Graph` and
+ * converting it, without the intermediate hash map.
+ *
+ * @param filename Path of the edge list or of the binary cache.
+ * @param threads  Number of threads that parse the edge list.
+ */
+
+CSRGraph::CSRGraph(const std::string& filename, size_t threads) {
+    auto file { std::make_shared<const MappedFile>(filename) };
+
+    if (file->size() >= sizeof(binary_magic) && std::memcmp(file->data(), binary_magic, sizeof(binary_magic)) == 0) {
+        loadBinary(file);
+    }
+
+    else {
+        loadEdgeList(*file, threads);
+    }
+}
+
+CSRGraph::CSRGraph(const CSRGraph& graph):
+    order(graph.order), size(graph.size), min_degree(graph.min_degree), max_degree(graph.max_degree),
+    offsets_storage(graph.offsets_storage), neighbors_storage(graph.neighbors_storage),
+    external_ids_storage(graph.external_ids_storage), mapping(graph.mapping),
+    offsets(graph.offsets), neighbors(graph.neighbors), external_ids(graph.external_ids),
+    adjacency_matrix(graph.adjacency_matrix), words_per_row(graph.words_per_row), 
+    sorted_adjacency(graph.sorted_adjacency) {
+
+    // arrays owned by `graph` are now owned by this copy; arrays in the shared mapping stay where they are.
+    if (graph.offsets == graph.offsets_storage.data()) { offsets = offsets_storage.data(); }
+    if (graph.neighbors == graph.neighbors_storage.data()) { neighbors = neighbors_storage.data(); }
+    if (graph.external_ids == graph.external_ids_storage.data()) { external_ids = external_ids_storage.data(); }
+}
+
+CSRGraph& CSRGraph::operator=(const CSRGraph& graph) {
+    if (this != &graph) {
+        *this = CSRGraph(graph);
+    }
+
+    return *this;
+}
+
+void CSRGraph::bindStorage() {
+    offsets = offsets_storage.data();
+    neighbors = neighbors_storage.data();
+    external_ids = external_ids_storage.data();
+}
+
+void CSRGraph::computeDegreeBounds() {
+    min_degree = max_degree = 0;
+
+    if (order > 0) {
+        min_degree = max_degree = getVertexDegree(0);
+        
+        for (size_t i {1}; i < order; ++i) {
+            min_degree = std::min(min_degree, getVertexDegree(i));
+            max_degree = std::max(max_degree, getVertexDegree(i));
+        }
+    }
+}
+
+// Parses the `source destination` pairs of the lines in `[first, last)`, which must start at a line boundary.
+
+static void parseEdges(const char* first, const char* last, std::vector<size_t>& endpoints) {
+    auto skipBlanks = [&](const char* position) {
+        while (position < last && (*position == ' ' || *position == '\t' || *position == '\r' || 
+                *position == '\v' || *position == '\f')) {
+            ++position;
+        }
+
+        return position;
+    };
+
+    auto skipLine = [&](const char* position) {
+        const void* newline { std::memchr(position, '\n', last - position) };
+        return newline ? static_cast<const char*>(newline) + 1 : last;
+    };
+
+    const char* position { first };
+    size_t source {0};
+    size_t destination {0};
+
+    while (position < last) {
+        auto parsed_source { std::from_chars(skipBlanks(position), last, source) };
+
+        if (parsed_source.ec == std::errc()) {
+            auto parsed_destination { std::from_chars(skipBlanks(parsed_source.ptr), last, destination) };
+
+            if (parsed_destination.ec == std::errc()) {
+                endpoints.push_back(source);
+                endpoints.push_back(destination);
+            }
+        }
+
+        position = skipLine(position);
+    }
+}
+
+/**
+ * @brief Builds the graph from a mapped text edge list.
+ *
+ * The file is split into chunks at line boundaries that are parsed in parallel with `std::from_chars`. Vertex ids
+ * are then remapped to 0..n-1 in increasing order (through a direct table when the ids are dense, otherwise by
+ * binary search over the sorted ids), and the adjacency is built in two passes over the edges: one counts the
+ * degrees, the other fills the neighbors in file order.
+ */
+
+void CSRGraph::loadEdgeList(const MappedFile& file, size_t threads) {
+    const char* data { file.data() };
+    const size_t length { file.size() };
+
+    ThreadPool pool(std::max<size_t>(threads, 1));
+
+    // a few chunks per thread keep the threads busy when lines have uneven lengths.
+    const size_t chunk_count { length == 0 ? 0 : std::min(length, pool.getThreadCount() * 4) };
+    std::vector<size_t> chunk_begin(chunk_count + 1, length);
+
+    for (size_t i {0}; i < chunk_count; ++i) {
+        size_t position { length / chunk_count * i };
+
+        if (i > 0) {
+            const void* newline { std::memchr(data + position - 1, '\n', length - position + 1) };
+            position = newline ? static_cast<const char*>(newline) - data + 1 : length;
+        }
+
+        chunk_begin[i] = std::max(position, i > 0 ? chunk_begin[i - 1] : 0);
+    }
+
+    std::vector<std::vector<size_t>> endpoints(chunk_count);
+
+    pool.parallelFor(chunk_count, [&](size_t chunk) {
+        parseEdges(data + chunk_begin[chunk], data + chunk_begin[chunk + 1], endpoints[chunk]);
+    });
+
+    size_t endpoint_count {0};
+    size_t max_id {0};
+
+    for (const auto& chunk : endpoints) {
+        endpoint_count += chunk.size();
+
+        for (const auto& id : chunk) {
+            max_id = std::max(max_id, id);
+        }
+    }
+
+    // vertex ids in increasing order; `dense_ids[id]` is only used when the ids are dense enough for a table.
+    std::vector<size_t> dense_ids;
+    const bool direct_table { endpoint_count > 0 && max_id / 4 <= endpoint_count };
+
+    if (direct_table) {
+        constexpr size_t absent { SIZE_MAX };
+        dense_ids.assign(max_id + 1, absent);
+
+        for (const auto& chunk : endpoints) {
+            for (const auto& id : chunk) {
+                dense_ids[id] = 0;
+            }
+        }
+
+        for (size_t id {0}; id <= max_id; ++id) {
+            if (dense_ids[id] != absent) {
+                dense_ids[id] = external_ids_storage.size();
+                external_ids_storage.push_back(id);
+            }
+        }
+    }
+
+    else {
+        for (const auto& chunk : endpoints) {
+            external_ids_storage.insert(external_ids_storage.end(), chunk.begin(), chunk.end());
+        }
+
+        std::sort(external_ids_storage.begin(), external_ids_storage.end());
+        external_ids_storage.erase(std::unique(external_ids_storage.begin(), external_ids_storage.end()), 
+            external_ids_storage.end());
+    }
+
+    order = external_ids_storage.size();
+
+    pool.parallelFor(chunk_count, [&](size_t chunk) {
+        for (auto& id : endpoints[chunk]) {
+            id = direct_table ? dense_ids[id] :
+                std::lower_bound(external_ids_storage.begin(), external_ids_storage.end(), id) - external_ids_storage.begin();
+        }
+    });
+
+    dense_ids = std::vector<size_t>();
+
+    buildAdjacency(endpoints);
+}
+
+/**
+ * @brief Builds the adjacency of `order` vertices from lists of `source destination` pairs of dense ids, in two
+ * passes: one counts the degrees, the other fills the neighbors in list order. Self-loops are dropped and the
+ * lists are released as they are consumed.
+ */
+
+void CSRGraph::buildAdjacency(std::vector<std::vector<size_t>>& endpoints) {
+    offsets_storage.assign(order + 1, 0);
+    size = 0;
+
+    for (const auto& chunk : endpoints) {
+        for (size_t i {0}; i < chunk.size(); i += 2) {
+            if (chunk[i] != chunk[i + 1]) {
+                ++offsets_storage[chunk[i] + 1];
+                ++offsets_storage[chunk[i + 1] + 1];
+                ++size;
+            }
+        }
+    }
+
+    for (size_t i {0}; i < order; ++i) {
+        offsets_storage[i + 1] += offsets_storage[i];
+    }
+
+    neighbors_storage.resize(offsets_storage[order]);
+    std::vector<size_t> next(offsets_storage.begin(), offsets_storage.end() - 1);
+
+    for (auto& chunk : endpoints) {
+        for (size_t i {0}; i < chunk.size(); i += 2) {
+            if (chunk[i] != chunk[i + 1]) {
+                neighbors_storage[next[chunk[i]]++] = chunk[i + 1];
+                neighbors_storage[next[chunk[i + 1]]++] = chunk[i];
+            }
+        }
+
+        chunk = std::vector<size_t>();
+    }
+
+    bindStorage();
+    computeDegreeBounds();
+}
+
+/**
+ * @brief Builds a graph on the vertices 0..order-1 from the flat list `endpoints` of `source destination` pairs.
+ * Used by the random generators; duplicate pairs are kept, so the caller must not produce them.
+ */
+
+CSRGraph::CSRGraph(size_t order, std::vector<size_t> endpoints): order(order), external_ids_storage(order) {
+    for (size_t i {0}; i < order; ++i) {
+        external_ids_storage[i] = i;
+    }
+
+    std::vector<std::vector<size_t>> lists(1);
+    lists[0] = std::move(endpoints);
+
+    buildAdjacency(lists);
+}
+
+/**
+ * @brief Uses a mapped `.trdg` cache in place: the arrays point into the mapping, which is kept alive by this
+ * graph and by its copies.
+ *
+ * The header sizes are checked against the file size without overflowing, and the arrays are validated in one pass
+ * (offsets start at 0 and never decrease, neighbor ids are vertices), so a corrupt cache is rejected instead of being
+ * read out of bounds later.
+ */
+
+void CSRGraph::loadBinary(std::shared_ptr<const MappedFile> file) {
+    uint64_t header[binary_header_words];
+
+    if (file->size() < binary_header_size) {
+        throw std::runtime_error("Invalid graph cache!");
+    }
+
+    std::memcpy(header, file->data() + sizeof(binary_magic), sizeof(header));
+
+    order = header[0];
+    size = header[1];
+    min_degree = header[2];
+    max_degree = header[3];
+
+    const size_t neighbor_count { header[4] };
+    const size_t max_words { std::numeric_limits<size_t>::max() / sizeof(size_t) };
+
+    if (order >= max_words / 2 || neighbor_count > max_words - 2 * order - 1) {
+        throw std::runtime_error("Invalid graph cache!");
+    }
+
+    const size_t words { (order + 1) + neighbor_count + order };
+
+    if ((file->size() - binary_header_size) / sizeof(size_t) != words ||
+            (file->size() - binary_header_size) % sizeof(size_t) != 0) {
+        throw std::runtime_error("Invalid graph cache!");
+    }
+
+    const size_t* arrays { reinterpret_cast<const size_t*>(file->data() + binary_header_size) };
+
+    if (arrays[0] != 0 || arrays[order] != neighbor_count) {
+        throw std::runtime_error("Invalid graph cache!");
+    }
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        if (arrays[vertex] > arrays[vertex + 1]) {
+            throw std::runtime_error("Invalid graph cache!");
+        }
+    }
+
+    for (size_t i {0}; i < neighbor_count; ++i) {
+        if (arrays[order + 1 + i] >= order) {
+            throw std::runtime_error("Invalid graph cache!");
+        }
+    }
+
+    offsets_storage.clear();
+    neighbors_storage.clear();
+    external_ids_storage.clear();
+
+    offsets = arrays;
+    neighbors = arrays + order + 1;
+    external_ids = neighbors + neighbor_count;
+    mapping = std::move(file);
+}
+
+/**
+ * @brief Writes the graph as a `.trdg` binary cache that later runs can map instead of parsing the edge list.
+ *
+ * The file is written under a temporary name and renamed at the end, so an interrupted run never leaves a
+ * truncated cache behind.
+ */
+
+void CSRGraph::save(const std::string& filename) const {
+    const std::string temporary { filename + ".tmp" };
+
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+        if (!file) {
+            throw std::runtime_error("Error writing the graph cache!");
+        }
+
+        const uint64_t header[binary_header_words] { order, size, min_degree, max_degree, offsets[order] };
+
+        file.write(binary_magic, sizeof(binary_magic));
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(offsets), (order + 1) * sizeof(size_t));
+        file.write(reinterpret_cast<const char*>(neighbors), offsets[order] * sizeof(size_t));
+        file.write(reinterpret_cast<const char*>(external_ids), order * sizeof(size_t));
+
+        if (!file) {
+            throw std::runtime_error("Error writing the graph cache!");
+        }
+    }
+
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Error writing the graph cache!");
+    }
+}
+
+/**
+ * @brief Returns the dense id of the vertex whose id in the input was `external_id`, by binary search over the
+ * sorted external ids.
+ */
+
+size_t CSRGraph::getVertex(size_t external_id) const {
+    const size_t* position { std::lower_bound(external_ids, external_ids + order, external_id) };
+
+    if (position == external_ids + order || *position != external_id) {
+        throw std::out_of_range("This vertex do not exists in the graph");
+    }
+
+    return static_cast<size_t>(position - external_ids);
+}
+
+/**
+ * @brief Builds the index used by `edgeExists`.
+ *
+ * Dense graphs, whose adjacency bit matrix takes at most twice the memory of the neighbor array and at most
+ * 64 MiB, get the matrix and O(1) queries. Otherwise every adjacency list is sorted, which makes queries
+ * O(log degree) by binary search; this changes the order in which neighbors are listed (a mapped cache is copied
+ * first, unless it was saved already sorted).
+ */
+
+void CSRGraph::buildEdgeIndex() {
+    if (hasEdgeIndex()) { return; }
+
+    constexpr size_t max_matrix_bytes { size_t {64} << 20 };
+    const size_t row_words { (order + 63) / 64 };
+    const double matrix_bytes { static_cast<double>(order) * row_words * sizeof(uint64_t) };
+
+    if (matrix_bytes <= max_matrix_bytes && matrix_bytes <= 2.0 * offsets[order] * sizeof(size_t)) {
+        words_per_row = row_words;
+        adjacency_matrix.assign(order * words_per_row, 0);
+
+        for (size_t vertex {0}; vertex < order; ++vertex) {
+            for (const auto& neighbor : getAdjacencyList(vertex)) {
+                adjacency_matrix[vertex * words_per_row + neighbor / 64] |= uint64_t {1} << (neighbor % 64);
+            }
+        }
+
+        return;
+    }
+
+    bool already_sorted {true};
+
+    for (size_t vertex {0}; vertex < order && already_sorted; ++vertex) {
+        already_sorted = std::is_sorted(neighbors + offsets[vertex], neighbors + offsets[vertex + 1]);
+    }
+
+    if (!already_sorted) {
+        if (neighbors != neighbors_storage.data()) {
+            neighbors_storage.assign(neighbors, neighbors + offsets[order]);
+            neighbors = neighbors_storage.data();
+        }
+
+        for (size_t vertex {0}; vertex < order; ++vertex) {
+            std::sort(neighbors_storage.begin() + offsets[vertex], neighbors_storage.begin() + offsets[vertex + 1]);
+        }
+    }
+
+    sorted_adjacency = true;
+}
+
+/**
+ * @brief Tells whether `u` and `v` are adjacent: O(1) with the matrix index, O(log degree) with sorted
+ * adjacency, and a scan of the shorter adjacency list without an index.
+ */
+
+bool CSRGraph::edgeExists(size_t u, size_t v) const {
+    if (!adjacency_matrix.empty()) {
+        return (adjacency_matrix[u * words_per_row + v / 64] >> (v % 64)) & 1;
+    }
+
+    if (getVertexDegree(u) > getVertexDegree(v)) {
+        std::swap(u, v);
+    }
+
+    const Neighborhood neighborhood { getAdjacencyList(u) };
+
+    if (sorted_adjacency) {
+        return std::binary_search(neighborhood.begin(), neighborhood.end(), v);
+    }
+
+    return std::find(neighborhood.begin(), neighborhood.end(), v) != neighborhood.end();
+}
+
+/**
+ * @brief Labels every vertex with the smallest vertex of its connected component.
+ *
+ * Components are found with a concurrent union-find: the edges are split among `threads` threads, and each union
+ * links the larger root below the smaller one with a compare-and-swap, retrying if another thread moved the root
+ * first. Roots only ever decrease, so the final root of a component is its smallest vertex whatever the thread
+ * interleaving, and no recursion is involved, so long paths cannot overflow the stack.
+ */
+
+std::vector<size_t> CSRGraph::componentLabels(size_t threads) const {
+    std::vector<std::atomic<size_t>> parent(order);
+    std::vector<size_t> labels(order);
+
+    auto find = [&](size_t vertex) {
+        size_t current { parent[vertex].load(std::memory_order_relaxed) };
+
+        while (current != vertex) {
+            // path halving: point `vertex` to its grandparent; a failed exchange only means someone else did.
+            size_t grandparent { parent[current].load(std::memory_order_relaxed) };
+            parent[vertex].compare_exchange_weak(current, grandparent, std::memory_order_relaxed);
+            vertex = current;
+            current = parent[vertex].load(std::memory_order_relaxed);
+        }
+
+        return vertex;
+    };
+
+    ThreadPool pool(std::max<size_t>(threads, 1));
+    constexpr size_t block_size {4096};
+    const size_t blocks { (order + block_size - 1) / block_size };
+
+    pool.parallelFor(blocks, [&](size_t block) {
+        for (size_t vertex {block * block_size}; vertex < std::min(order, (block + 1) * block_size); ++vertex) {
+            parent[vertex].store(vertex, std::memory_order_relaxed);
+        }
+    });
+
+    pool.parallelFor(blocks, [&](size_t block) {
+        for (size_t vertex {block * block_size}; vertex < std::min(order, (block + 1) * block_size); ++vertex) {
+            for (const auto& neighbor : getAdjacencyList(vertex)) {
+                if (neighbor >= vertex) { continue; }
+
+                while (true) {
+                    size_t root_u { find(vertex) };
+                    size_t root_v { find(neighbor) };
+
+                    if (root_u == root_v) { break; }
+
+                    if (root_u < root_v) {
+                        std::swap(root_u, root_v);
+                    }
+
+                    if (parent[root_u].compare_exchange_strong(root_u, root_v, std::memory_order_relaxed)) { break; }
+                }
+            }
+        }
+    });
+
+    pool.parallelFor(blocks, [&](size_t block) {
+        for (size_t vertex {block * block_size}; vertex < std::min(order, (block + 1) * block_size); ++vertex) {
+            labels[vertex] = find(vertex);
+        }
+    });
+
+    return labels;
+}
+
+/**
+ * @brief Returns, for every connected component in increasing order of its smallest vertex, its order and its
+ * minimum degree.
+ */
+
+std::vector<std::pair<size_t, size_t>> CSRGraph::connectedComponents(size_t threads) const {
+    const std::vector<size_t> labels { componentLabels(threads) };
+    std::vector<size_t> index(order);
+    std::vector<std::pair<size_t, size_t>> components;
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        if (labels[vertex] == vertex) {
+            index[vertex] = components.size();
+            components.push_back({0, getVertexDegree(vertex)});
+        }
+
+        auto& component { components[index[labels[vertex]]] };
+        ++component.first;
+        component.second = std::min(component.second, getVertexDegree(vertex));
+    }
+
+    return components;
+}
+
+/**
+ * @brief Returns the vertices of every connected component, in increasing order, with the components in increasing
+ * order of their smallest vertex.
+ */
+
+std::vector<std::vector<size_t>> CSRGraph::components(size_t threads) const {
+    const std::vector<size_t> labels { componentLabels(threads) };
+    std::vector<size_t> index(order);
+    std::vector<std::vector<size_t>> components;
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        if (labels[vertex] == vertex) {
+            index[vertex] = components.size();
+            components.emplace_back();
+        }
+
+        components[index[labels[vertex]]].push_back(vertex);
+    }
+
+    return components;
+}
+
+/**
+ * @brief Returns the subgraph induced by `vertices`, which must be sorted; vertex i of the subgraph is `vertices[i]`.
+ * Runs in O(sum of degrees * log |vertices|).
+ */
+
+CSRGraph CSRGraph::subgraph(const std::vector<size_t>& vertices) const {
+    std::vector<size_t> endpoints;
+
+    for (size_t i {0}; i < vertices.size(); ++i) {
+        for (size_t neighbor : getAdjacencyList(vertices[i])) {
+            auto position { std::lower_bound(vertices.begin(), vertices.end(), neighbor) };
+
+            if (neighbor > vertices[i] && position != vertices.end() && *position == neighbor) {
+                endpoints.push_back(i);
+                endpoints.push_back(static_cast<size_t>(position - vertices.begin()));
+            }
+        }
+    }
+
+    return CSRGraph(vertices.size(), std::move(endpoints));
+}
+
+bool CSRGraph::isBinaryFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(binary_magic)] {};
+
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, binary_magic, sizeof(magic)) == 0;
+}
+
+std::ostream& operator<< (std::ostream& os, const CSRGraph& graph) {
+    for (size_t vertex {0}; vertex < graph.getOrder(); ++vertex) {
+        os << graph.getExternalId(vertex) << " ----> ";
+        
+        for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+            os << graph.getExternalId(neighbor) << " ";
+        }
+        
+        os << '\n';
+    }
+    
+    return os;
+}
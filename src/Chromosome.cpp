@@ -1,16 +1,16 @@
 #include "Chromosome.hpp"
 
-Chromosome::Chromosome(const std::vector<int>& genes) {
+Chromosome::Chromosome(const std::vector<Gene>& genes) {
 	this->genes = genes;
 	this->fitness = 0;
 }
 
 Chromosome::Chromosome(size_t genes_size) {
-    this->genes = std::vector<int>(genes_size, -1);
+    this->genes = std::vector<Gene>(genes_size, unlabeled);
     this->fitness = 0;
 } 
 
-Chromosome::Chromosome(const std::vector<int>& first_half, const std::vector<int>& second_half) {
+Chromosome::Chromosome(const std::vector<Gene>& first_half, const std::vector<Gene>& second_half) {
     this->genes = first_half;
     this->genes.insert(this->genes.end(), second_half.begin(), second_half.end());
     this->fitness  = 0;
@@ -19,20 +19,86 @@ Chromosome::Chromosome(const std::vector<int>& first_half, const std::vector<int
 Chromosome::Chromosome(const Chromosome& chromosome) {
     this->genes = chromosome.genes;
     this->fitness = chromosome.fitness ;
+    this->neighborhood = chromosome.neighborhood;
 }
 
 Chromosome& Chromosome::operator=(const Chromosome& chromosome) {
 	if (this != &chromosome) { 
 	    genes = chromosome.genes;
 	    fitness = chromosome.fitness;
+	    neighborhood = chromosome.neighborhood;
 	}
 	    
 	return *this;
 }
 
+static void addNeighborLabel(NeighborhoodWeight& weight, int label, int sign) {
+    if (label <= 0) { return; }
+    
+    weight.label_sum += sign * label;
+    weight.active += sign;
+    
+    if (label == 2) {
+        weight.neighbors_2 += sign;
+    }
+    
+    else if (label == 3) {
+        weight.neighbors_3 += sign;
+    }
+    
+    else if (label == 4) {
+        weight.neighbors_4 += sign;
+    }
+}
+
+/**
+ * @brief Altera o rótulo de um vértice mantendo o fitness atualizado.
+ * 
+ * Se o cache de vizinhança estiver ativo, os agregados de cada vizinho do vértice são atualizados em O(grau).
+ */
+
+void Chromosome::setGene(const CSRGraph& graph, size_t vertex, int label) {
+    int old_label { genes[vertex] };
+    
+    if (old_label == label) { return; }
+    
+    fitness = fitness + label - old_label;
+    genes[vertex] = label;
+    
+    if (!neighborhood.empty()) {
+        for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+            addNeighborLabel(neighborhood[neighbor], old_label, -1);
+            addNeighborLabel(neighborhood[neighbor], label, 1);
+        }
+    }
+}
+
+/**
+ * @brief Constrói, para cada vértice, a soma dos rótulos dos vizinhos, o número de vizinhos ativos 
+ * (rótulo > 0) e quantos vizinhos têm rótulo 2, 3 e 4. Com o cache ativo, as consultas de viabilidade 
+ * passam a ser O(1).
+ */
+
+void Chromosome::buildNeighborhoodCache(const CSRGraph& graph) {
+    neighborhood.assign(genes.size(), NeighborhoodWeight {});
+    
+    for (size_t vertex {0}; vertex < genes.size(); ++vertex) {
+        for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+            addNeighborLabel(neighborhood[vertex], genes[neighbor], 1);
+        }
+    }
+}
+
+void Chromosome::clearNeighborhoodCache() {
+    neighborhood.clear();
+    neighborhood.shrink_to_fit();
+}
+
+bool Chromosome::hasNeighborhoodCache() const { return !neighborhood.empty(); }
+
 std::ostream& operator<<(std::ostream& os, const Chromosome& chromosome) {
     for (const auto& it: chromosome.genes) {
-        os << it << " ";
+        os << static_cast<int>(it) << " ";
     }
     return os;
 }
@@ -0,0 +1,116 @@
+#include "ComponentSolver.hpp"
+#include "ExactSolver.hpp"
+#include "TripleRomanDomination.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Separa o grafo em componentes conexas e resolve, de forma exata, as que têm até `exact_order` vértices.
+ *
+ * Cada componente vira um `CSRGraph` próprio, com os vértices renumerados em ordem crescente; `vertices` guarda o
+ * vértice original de cada um deles. As componentes maiores, e as pequenas que o resolvedor exato não fecha em
+ * `exact_node_limit` nós, ficam em `large_components`, para o algoritmo genético.
+ *
+ * @param threads          Número de componentes grandes resolvidas simultaneamente em `solve`; cada algoritmo
+ *                         genético usa uma única thread.
+ * @param exact_node_limit Número máximo de nós explorados pelo resolvedor exato em cada componente (0 sem limite).
+ */
+
+ComponentSolver::ComponentSolver(const CSRGraph& graph, size_t population_size, size_t generations, float elitism_rate,
+    float crossover_rate, float mutation_rate, float tournament_population_size, size_t threads, size_t exact_order,
+    size_t exact_node_limit)
+    : exact_solution(graph.getOrder(), 0), population_size(population_size), generations(generations),
+      elitism_rate(elitism_rate), crossover_rate(crossover_rate), mutation_rate(mutation_rate),
+      tournament_population_size(tournament_population_size), threads(threads) {
+
+    std::vector<std::vector<size_t>> members { graph.components(threads) };
+    components.reserve(members.size());
+
+    for (auto& vertices : members) {
+        CSRGraph subgraph { graph.subgraph(vertices) };
+        components.push_back({std::move(subgraph), std::move(vertices)});
+        const Component& component { components.back() };
+
+        std::vector<Gene> labeling;
+
+        if (component.vertices.size() > exact_order || !solveExactly(component.subgraph, exact_node_limit, labeling)) {
+            large_components.push_back(components.size() - 1);
+            continue;
+        }
+
+        for (size_t i {0}; i < labeling.size(); ++i) {
+            exact_solution[component.vertices[i]] = labeling[i];
+            exact_fitness += labeling[i];
+        }
+    }
+}
+
+/**
+ * @brief Calcula uma FDRT de peso mínimo de um grafo pequeno com `ExactSolver`.
+ *
+ * @param graph      Grafo a ser rotulado.
+ * @param node_limit Número máximo de nós explorados (0 sem limite).
+ * @param labeling   Recebe o rótulo de cada vértice de `graph`, que só é ótimo quando o retorno é verdadeiro.
+ * @return Se o ótimo foi comprovado dentro de `node_limit` nós.
+ */
+
+bool ComponentSolver::solveExactly(const CSRGraph& graph, size_t node_limit, std::vector<Gene>& labeling) {
+    ExactSolver solver(graph, node_limit);
+    bool optimal { solver.solve() };
+    labeling = solver.getSolution();
+
+    return optimal;
+}
+
+/**
+ * @brief Executa um algoritmo genético em cada componente grande e junta as soluções às das componentes pequenas.
+ *
+ * As componentes grandes são resolvidas em paralelo; a componente `i` usa a semente `mixSeed(seed, i)`, então o
+ * resultado não depende do número de threads. Como as populações das componentes são independentes, a média do
+ * fitness da solução reunida é a soma das médias, e o desvio padrão é a raiz da soma das variâncias. Na diversidade
+ * inicial, a distância de Hamming média é a soma das distâncias das componentes, e o número de genomas distintos é o
+ * maior entre elas (um limite inferior para o número de combinações distintas).
+ */
+
+ComponentSolution ComponentSolver::solve(uint64_t seed, short int heuristic, bool flag_elitism, bool flag_selection,
+    bool flag_crossover, bool flag_mutation) const {
+
+    std::vector<ComponentSolution> partial(large_components.size());
+    ThreadPool pool(std::min(threads, large_components.size()));
+
+    pool.parallelFor(large_components.size(), [&](size_t i) {
+        const CSRGraph& subgraph { components[large_components[i]].subgraph };
+
+        TripleRomanDomination trd(subgraph, population_size, subgraph.getOrder(), generations, elitism_rate,
+            crossover_rate, mutation_rate, tournament_population_size, mixSeed(seed, i));
+
+        trd.setLocalSearch(local_search);
+        trd.runGeneticAlgorithm(heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+
+        partial[i] = {trd.getSolutionGeneticAlgorithm(), trd.getGeneticAlgorithmBestFitness(),
+            trd.getGeneticAlgorithmFitnessMean(), trd.getGeneticAlgorithmFitnessSTD(), trd.getInitialDiversity()};
+    });
+
+    ComponentSolution result {exact_solution, exact_fitness, static_cast<float>(exact_fitness), 0, {1, 0}};
+    float variance {0};
+
+    for (size_t i {0}; i < partial.size(); ++i) {
+        const std::vector<size_t>& vertices { components[large_components[i]].vertices };
+
+        for (size_t j {0}; j < vertices.size(); ++j) {
+            result.solution[vertices[j]] = partial[i].solution[j];
+        }
+
+        result.best_fitness += partial[i].best_fitness;
+        result.fitness_mean += partial[i].fitness_mean;
+        variance += partial[i].fitness_std * partial[i].fitness_std;
+        result.initial_diversity.distinct_genomes = std::max(result.initial_diversity.distinct_genomes,
+            partial[i].initial_diversity.distinct_genomes);
+        result.initial_diversity.mean_hamming_distance += partial[i].initial_diversity.mean_hamming_distance;
+    }
+
+    result.fitness_std = std::sqrt(variance);
+
+    return result;
+}
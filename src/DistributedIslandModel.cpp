@@ -0,0 +1,226 @@
+#include "DistributedIslandModel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+template <typename Value>
+void appendValue(std::vector<uint8_t>& buffer, Value value) {
+    size_t offset { buffer.size() };
+    buffer.resize(offset + sizeof(Value));
+    std::memcpy(buffer.data() + offset, &value, sizeof(Value));
+}
+
+template <typename Value>
+Value readValue(const std::vector<uint8_t>& buffer, size_t& offset) {
+    if (offset + sizeof(Value) > buffer.size()) {
+        throw std::runtime_error("Truncated island message");
+    }
+
+    Value value;
+    std::memcpy(&value, buffer.data() + offset, sizeof(Value));
+    offset += sizeof(Value);
+
+    return value;
+}
+
+// os rótulos {0, ..., 4} cabem em 4 bits, então cada byte da mensagem leva os rótulos de dois vértices.
+
+void packGenes(const std::vector<Gene>& genes, std::vector<uint8_t>& buffer) {
+    size_t offset { buffer.size() };
+    buffer.resize(offset + (genes.size() + 1) / 2, 0);
+
+    for (size_t i {0}; i < genes.size(); ++i) {
+        buffer[offset + i / 2] |= static_cast<uint8_t>((genes[i] & 0x0F) << (4 * (i % 2)));
+    }
+}
+
+void unpackGenes(const std::vector<uint8_t>& buffer, size_t& offset, std::vector<Gene>& genes) {
+    size_t length { (genes.size() + 1) / 2 };
+
+    if (offset + length > buffer.size()) {
+        throw std::runtime_error("Truncated island message");
+    }
+
+    for (size_t i {0}; i < genes.size(); ++i) {
+        genes[i] = (buffer[offset + i / 2] >> (4 * (i % 2))) & 0x0F;
+    }
+
+    offset += length;
+}
+
+} // namespace
+
+/**
+ * @brief Cria a ilha deste processo. Ela usa a semente `mixSeed(seed, rank)` e a topologia é sorteada a partir de
+ * `mixSeed(seed, processos)`, igual em todos os processos, então todos concordam sobre quem envia a quem.
+ */
+
+DistributedIslandModel::DistributedIslandModel(Transport& transport, const CSRGraph& graph, size_t population_size,
+    size_t genes_size, size_t generations, float elitism_rate, float crossover_rate, float mutation_rate,
+    size_t tournament_population_size, uint64_t seed, size_t migration_interval, size_t migrants,
+    MigrationTopology topology)
+    : transport(transport), graph(graph),
+      genetic_algorithm(graph, population_size, genes_size, generations, elitism_rate, crossover_rate, mutation_rate,
+        tournament_population_size, mixSeed(seed, transport.getRank())),
+      generations(generations), migration_interval(std::max<size_t>(migration_interval, 1)), migrants(migrants),
+      topology(topology), random_state(mixSeed(seed, transport.getSize())) {}
+
+/**
+ * @brief Envia os melhores indivíduos desta ilha às ilhas que os recebem na topologia, recebe os das suas fontes e
+ * substitui por eles os piores indivíduos da população. O fitness dos imigrantes é recalculado a partir dos genes.
+ */
+
+void DistributedIslandModel::migrate() {
+    const size_t rank { transport.getRank() };
+
+    chooseMigrationSources(topology, transport.getSize(), random_state, sources);
+
+    std::vector<size_t> destinations;
+
+    for (size_t island {0}; island < sources.size(); ++island) {
+        if (std::find(sources[island].begin(), sources[island].end(), rank) != sources[island].end()) {
+            destinations.push_back(island);
+        }
+    }
+
+    genetic_algorithm.getBestIndividuals(migrants, emigrants);
+
+    outgoing.clear();
+    appendValue<uint64_t>(outgoing, emigrants.size());
+
+    for (const auto& emigrant : emigrants) {
+        packGenes(emigrant.genes, outgoing);
+    }
+
+    transport.exchange(destinations, outgoing, sources[rank], incoming);
+
+    immigrants.clear();
+
+    for (const auto& message : incoming) {
+        size_t offset {0};
+        size_t count { readValue<uint64_t>(message, offset) };
+
+        for (size_t i {0}; i < count; ++i) {
+            Chromosome immigrant(graph.getOrder());
+            unpackGenes(message, offset, immigrant.genes);
+            immigrants.push_back(std::move(fitness(immigrant)));
+        }
+    }
+
+    genetic_algorithm.replaceWorstIndividuals(immigrants);
+}
+
+/**
+ * @brief Reúne no processo 0 o resultado de todas as ilhas, combinado como em `IslandModel::run`. Os demais processos
+ * ficam com o resultado da própria ilha.
+ */
+
+void DistributedIslandModel::gatherResults(const std::tuple<size_t, float, float>& statistics) {
+    std::tie(best_fitness, fitness_mean, fitness_std) = statistics;
+    best_fitness = genetic_algorithm.getBestFitness();
+    best_solution = genetic_algorithm.getBestSolution();
+    initial_diversity = genetic_algorithm.getInitialDiversity();
+
+    const size_t size { transport.getSize() };
+
+    if (size == 1) {
+        return;
+    }
+
+    if (transport.getRank() != 0) {
+        outgoing.clear();
+        appendValue<uint64_t>(outgoing, best_fitness);
+        appendValue<float>(outgoing, fitness_mean);
+        appendValue<float>(outgoing, fitness_std);
+        appendValue<uint64_t>(outgoing, initial_diversity.distinct_genomes);
+        appendValue<float>(outgoing, initial_diversity.mean_hamming_distance);
+        packGenes(best_solution, outgoing);
+
+        transport.exchange({0}, outgoing, {}, incoming);
+        return;
+    }
+
+    std::vector<size_t> others;
+
+    for (size_t island {1}; island < size; ++island) {
+        others.push_back(island);
+    }
+
+    transport.exchange({}, outgoing, others, incoming);
+
+    float sum_squares { fitness_std * fitness_std + fitness_mean * fitness_mean };
+
+    for (const auto& message : incoming) {
+        size_t offset {0};
+        size_t island_fitness { readValue<uint64_t>(message, offset) };
+        float mean { readValue<float>(message, offset) };
+        float std { readValue<float>(message, offset) };
+
+        fitness_mean += mean;
+        sum_squares += std * std + mean * mean;
+        initial_diversity.distinct_genomes += readValue<uint64_t>(message, offset);
+        initial_diversity.mean_hamming_distance += readValue<float>(message, offset);
+
+        if (island_fitness < best_fitness) {
+            best_fitness = island_fitness;
+            unpackGenes(message, offset, best_solution);
+        }
+    }
+
+    fitness_mean /= size;
+    fitness_std = std::sqrt(std::max(0.0f, sum_squares / size - fitness_mean * fitness_mean));
+    initial_diversity.mean_hamming_distance /= size;
+}
+
+/**
+ * @brief Executa a ilha deste processo: a primeira época, com a criação da população inicial, é uma chamada de
+ * `GeneticAlgorithm::run`, e as seguintes continuam a evolução com `evolve` depois de cada migração. Todos os
+ * processos devem chamar `run` com os mesmos parâmetros.
+ *
+ * @return No processo 0, o melhor fitness, a média e o desvio padrão de todas as ilhas; nos demais, os da própria ilha.
+ */
+
+std::tuple<size_t, float, float> DistributedIslandModel::run(
+    std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics, size_t chosen_heuristic, bool flag_elitism,
+    bool flag_selection, bool flag_crossover, bool flag_mutation) {
+
+    size_t generation { std::min(migration_interval, generations) };
+
+    auto statistics { genetic_algorithm.run(generation, heuristics, chosen_heuristic, flag_elitism, flag_selection,
+        flag_crossover, flag_mutation) };
+
+    while (generation < generations) {
+        migrate();
+
+        size_t epoch { std::min(migration_interval, generations - generation) };
+        generation += epoch;
+
+        statistics = genetic_algorithm.evolve(epoch, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+    }
+
+    gatherResults(statistics);
+
+    return {best_fitness, fitness_mean, fitness_std};
+}
+
+std::vector<Gene> DistributedIslandModel::getBestSolution() { return best_solution; }
+
+size_t DistributedIslandModel::getBestFitness() { return best_fitness; }
+
+float DistributedIslandModel::getFitnessMean() { return fitness_mean; }
+
+float DistributedIslandModel::getFitnessSTD() { return fitness_std; }
+
+PopulationDiversity DistributedIslandModel::getInitialDiversity() { return initial_diversity; }
+
+/**
+ * @brief Aplica a busca local memética à ilha deste processo; todos os processos devem receber os mesmos parâmetros
+ * para que o resultado continue igual ao de `IslandModel`.
+ */
+
+void DistributedIslandModel::setLocalSearch(const LocalSearchSettings& settings) {
+    genetic_algorithm.setLocalSearch(settings);
+}
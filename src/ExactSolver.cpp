@@ -0,0 +1,733 @@
+#include "ExactSolver.hpp"
+#include "TripleRomanDomination.hpp"
+#include "util_functions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+namespace {
+
+constexpr size_t none { static_cast<size_t>(-1) };
+constexpr size_t infeasible { static_cast<size_t>(-2) };
+constexpr size_t word_bits {64};
+constexpr double epsilon {1e-9};
+
+// componentes maiores que isso não guardam a matriz de adjacência em bitsets, que ocupa order² bits.
+constexpr size_t bitset_order {8192};
+
+// passos de subgradiente na raiz, que parte dos multiplicadores de `LowerBounds`, e em cada nó; os nós partem dos
+// multiplicadores do pai, então precisam de poucos.
+constexpr size_t root_iterations {300};
+constexpr size_t node_iterations {20};
+
+bool testBit(const std::vector<uint64_t>& bits, size_t i) { return (bits[i / word_bits] >> (i % word_bits)) & 1; }
+
+void setBit(std::vector<uint64_t>& bits, size_t i) { bits[i / word_bits] |= uint64_t {1} << (i % word_bits); }
+
+void resetBit(std::vector<uint64_t>& bits, size_t i) { bits[i / word_bits] &= ~(uint64_t {1} << (i % word_bits)); }
+
+// cobertura que o rótulo `label_index` + 2 de um vértice dá a ele mesmo (offset 0) ou a um vizinho (offset 1), sem
+// contar o que passa do déficit `need` do vértice coberto.
+double coefficient(size_t label_index, size_t offset, size_t need) {
+    return static_cast<double>(std::min(label_index + 2 - offset, need));
+}
+
+size_t roundUp(double value) { return static_cast<size_t>(std::max(0.0, std::ceil(value - 1e-6))); }
+
+// Busca em uma componente conexa. A cobertura de um vértice v é f(v) mais, para cada vizinho u com f(u) > 0,
+// f(u) - 1; v está satisfeito quando ela chega a 3, o que equivale à restrição da FDRT. Vértices livres (conjunto
+// `free`) contam como rótulo 0 até serem fixados.
+//
+// Cada nó resolve um subproblema: satisfazer, com o menor peso possível, os vértices com déficit de um escopo usando
+// os vértices livres. Quando os vértices com déficit se separam em grupos que não compartilham nenhum vértice livre,
+// os grupos são subproblemas independentes, resolvidos um a um, e os seus custos se somam em vez de se multiplicarem.
+
+class Search {
+private:
+    using Labeling = std::vector<std::pair<size_t, Gene>>;
+
+    const CSRGraph& graph;
+    const size_t order;
+    const size_t words;
+    const size_t node_limit;
+
+    std::vector<uint64_t> adjacency;
+    std::vector<uint64_t> free;
+    std::vector<Gene> labels;
+    std::vector<int> coverage;
+    size_t weight {0};
+
+    // `mark[v] == stamp` para os vértices com déficit do nó atual; `seen` evita repetições nas varreduras.
+    std::vector<size_t> mark;
+    size_t stamp {0};
+    std::vector<size_t> seen;
+    size_t seen_stamp {0};
+    std::vector<size_t> part;
+    std::vector<size_t> fixed;
+
+    std::vector<double> multipliers;
+    std::vector<std::pair<size_t, double>> saved_multipliers;
+    std::vector<double> trial;
+    std::vector<double> subgradient;
+    std::vector<double> reduced_cost;
+
+    size_t deficit(size_t vertex) const { return coverage[vertex] >= 3 ? 0 : 3 - coverage[vertex]; }
+
+    size_t freeNeighbors(size_t vertex) const {
+        size_t count {0};
+
+        if (adjacency.empty()) {
+            for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+                count += testBit(free, neighbor);
+            }
+
+            return count;
+        }
+
+        for (size_t w {0}; w < words; ++w) {
+            count += __builtin_popcountll(adjacency[vertex * words + w] & free[w]);
+        }
+
+        return count;
+    }
+
+    // chama `function(u, offset)` para cada vértice livre u da vizinhança fechada de `vertex`, com offset 0 para o
+    // próprio vértice e 1 para os vizinhos.
+    template <typename Function>
+    void forEachOption(size_t vertex, Function function) const {
+        if (testBit(free, vertex)) {
+            function(vertex, 0);
+        }
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            if (testBit(free, neighbor)) {
+                function(neighbor, 1);
+            }
+        }
+    }
+
+    void assign(size_t vertex, Gene label);
+    void unassign(size_t vertex);
+    size_t chooseTarget(const std::vector<size_t>& scope, std::vector<size_t>& deficient) const;
+    void markDeficient(const std::vector<size_t>& deficient, std::vector<size_t>& candidates);
+    double lagrangian(const std::vector<double>& values, const std::vector<size_t>& deficient,
+        const std::vector<size_t>& candidates);
+    double lowerBound(size_t iterations, size_t cap, const std::vector<size_t>& deficient,
+        const std::vector<size_t>& candidates);
+    size_t split(const std::vector<size_t>& deficient);
+    size_t solveParts(size_t parts, size_t cap, const std::vector<size_t>& deficient,
+        const std::vector<size_t>& candidates, Labeling& solution);
+    size_t branchOn(size_t target, size_t cap, const std::vector<size_t>& deficient, Labeling& solution);
+    size_t solve(const std::vector<size_t>& scope, size_t cap, Labeling& solution);
+
+public:
+    std::vector<Gene> best;
+    size_t best_weight {0};
+    size_t root_bound {0};
+    size_t nodes {0};
+    bool aborted {false};
+
+    Search(const CSRGraph& graph, size_t node_limit, std::vector<Gene> incumbent);
+
+    void run(const std::vector<double>& initial_multipliers, size_t known_bound);
+};
+
+Search::Search(const CSRGraph& graph, size_t node_limit, std::vector<Gene> incumbent)
+    : graph(graph), order(graph.getOrder()), words((graph.getOrder() + word_bits - 1) / word_bits),
+      node_limit(node_limit), free(words, 0), labels(order, 0), coverage(order, 0), mark(order, 0), seen(order, 0),
+      part(order, 0), multipliers(order, 0), trial(order, 0), subgradient(order, 0), reduced_cost(order, 0),
+      best(std::move(incumbent)) {
+
+    for (Gene label : best) {
+        best_weight += label;
+    }
+
+    if (order <= bitset_order) {
+        adjacency.assign(order * words, 0);
+    }
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        setBit(free, vertex);
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            if (!adjacency.empty()) {
+                adjacency[vertex * words + neighbor / word_bits] |= uint64_t {1} << (neighbor % word_bits);
+            }
+        }
+    }
+}
+
+void Search::assign(size_t vertex, Gene label) {
+    resetBit(free, vertex);
+    labels[vertex] = label;
+    weight += label;
+    coverage[vertex] += label;
+
+    for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+        coverage[neighbor] += label - 1;
+    }
+}
+
+void Search::unassign(size_t vertex) {
+    Gene label { labels[vertex] };
+
+    setBit(free, vertex);
+    labels[vertex] = 0;
+    weight -= label;
+    coverage[vertex] -= label;
+
+    for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+        coverage[neighbor] -= label - 1;
+    }
+}
+
+/**
+ * @brief Preenche `deficient` com os vértices de `scope` que ainda não estão satisfeitos e escolhe entre eles o que tem
+ * menos vértices livres na vizinhança fechada, preferindo o de maior déficit.
+ *
+ * @return O vértice escolhido; `none` se todos estão satisfeitos ou `infeasible` se algum não pode mais ser, nem com
+ * rótulo 4 em todos os vértices livres da sua vizinhança fechada.
+ */
+
+size_t Search::chooseTarget(const std::vector<size_t>& scope, std::vector<size_t>& deficient) const {
+    deficient.clear();
+
+    size_t target { none };
+    size_t target_options {0};
+
+    for (size_t vertex : scope) {
+        size_t need { deficit(vertex) };
+
+        if (need == 0) {
+            continue;
+        }
+
+        size_t neighbors { freeNeighbors(vertex) };
+        bool is_free { testBit(free, vertex) };
+
+        if (coverage[vertex] + 3 * static_cast<int>(neighbors) + (is_free ? 4 : 0) < 3) {
+            return infeasible;
+        }
+
+        size_t options { neighbors + is_free };
+        deficient.push_back(vertex);
+
+        if (target == none || options < target_options || (options == target_options && need > deficit(target))) {
+            target = vertex;
+            target_options = options;
+        }
+    }
+
+    return target;
+}
+
+/**
+ * @brief Marca os vértices de `deficient` como os do nó atual e lista em `candidates` os vértices livres das suas
+ * vizinhanças fechadas, os únicos cujo rótulo importa para o subproblema.
+ */
+
+void Search::markDeficient(const std::vector<size_t>& deficient, std::vector<size_t>& candidates) {
+    ++stamp;
+    ++seen_stamp;
+    candidates.clear();
+
+    for (size_t vertex : deficient) {
+        mark[vertex] = stamp;
+
+        forEachOption(vertex, [&](size_t option, size_t) {
+            if (seen[option] != seen_stamp) {
+                seen[option] = seen_stamp;
+                candidates.push_back(option);
+            }
+        });
+    }
+}
+
+/**
+ * @brief Relaxação lagrangiana das restrições de cobertura do nó atual com multiplicadores `values`, mantendo que cada
+ * vértice livre recebe no máximo um rótulo: cada candidato fica com o rótulo de menor custo reduzido, se ele for
+ * negativo. Para quaisquer multiplicadores não negativos, o valor é um limite inferior para o custo do subproblema, e o
+ * seu máximo é o valor da relaxação linear. Como cada coeficiente é limitado pelo déficit do vértice coberto, com os
+ * mesmos multiplicadores o valor nunca é menor que o da relaxação de `LowerBounds`.
+ *
+ * @return O valor da relaxação; `subgradient` e `reduced_cost` recebem o subgradiente e o menor custo reduzido de
+ * cada candidato.
+ */
+
+double Search::lagrangian(const std::vector<double>& values, const std::vector<size_t>& deficient,
+    const std::vector<size_t>& candidates) {
+
+    double value {0};
+
+    for (size_t vertex : deficient) {
+        value += deficit(vertex) * values[vertex];
+        subgradient[vertex] = static_cast<double>(deficit(vertex));
+    }
+
+    for (size_t vertex : candidates) {
+        if (!testBit(free, vertex)) {
+            continue;
+        }
+
+        double reduced[3] {2, 3, 4};
+
+        auto price = [&](size_t covered, size_t offset) {
+            if (mark[covered] == stamp) {
+                for (size_t l {0}; l < 3; ++l) {
+                    reduced[l] -= coefficient(l, offset, deficit(covered)) * values[covered];
+                }
+            }
+        };
+
+        price(vertex, 0);
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            price(neighbor, 1);
+        }
+
+        size_t label { static_cast<size_t>(std::min_element(reduced, reduced + 3) - reduced) };
+        reduced_cost[vertex] = reduced[label];
+
+        if (reduced[label] >= 0) {
+            continue;
+        }
+
+        value += reduced[label];
+
+        auto cover = [&](size_t covered, size_t offset) {
+            if (mark[covered] == stamp) {
+                subgradient[covered] -= coefficient(label, offset, deficit(covered));
+            }
+        };
+
+        cover(vertex, 0);
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            cover(neighbor, 1);
+        }
+    }
+
+    return value;
+}
+
+/**
+ * @brief Limite inferior para o custo do subproblema, dado pela relaxação lagrangiana. Os multiplicadores atuais são
+ * melhorados por `iterations` passos de subgradiente com o passo de Polyak, mirando em `cap`, o custo a partir do qual
+ * o nó pode ser podado, e os melhores ficam em `multipliers` como ponto de partida dos filhos.
+ */
+
+double Search::lowerBound(size_t iterations, size_t cap, const std::vector<size_t>& deficient,
+    const std::vector<size_t>& candidates) {
+
+    const double target { static_cast<double>(cap) };
+    double value { lagrangian(multipliers, deficient, candidates) };
+    double scale {1};
+    size_t failures {0};
+    bool current {true};
+
+    for (size_t vertex : deficient) {
+        trial[vertex] = multipliers[vertex];
+    }
+
+    for (size_t iteration {0}; iteration < iterations && roundUp(value) < cap; ++iteration) {
+        double norm {0};
+
+        for (size_t vertex : deficient) {
+            norm += subgradient[vertex] * subgradient[vertex];
+        }
+
+        if (norm < epsilon) {
+            break;
+        }
+
+        const double step { scale * (target - value) / norm };
+
+        for (size_t vertex : deficient) {
+            trial[vertex] = std::max(0.0, trial[vertex] + step * subgradient[vertex]);
+        }
+
+        double candidate { lagrangian(trial, deficient, candidates) };
+        current = candidate > value;
+
+        if (current) {
+            value = candidate;
+
+            for (size_t vertex : deficient) {
+                multipliers[vertex] = trial[vertex];
+            }
+        }
+
+        else if (++failures % 5 == 0) {
+            scale /= 2;
+        }
+    }
+
+    // os custos reduzidos usados depois devem ser os dos melhores multiplicadores.
+    if (!current) {
+        lagrangian(multipliers, deficient, candidates);
+    }
+
+    return value;
+}
+
+/**
+ * @brief Separa os vértices com déficit do nó atual em grupos que não compartilham vértices livres; `part[v]` recebe o
+ * grupo de cada um.
+ *
+ * @return O número de grupos.
+ */
+
+size_t Search::split(const std::vector<size_t>& deficient) {
+    std::vector<size_t> stack;
+    size_t parts {0};
+
+    ++seen_stamp;
+
+    for (size_t start : deficient) {
+        if (seen[start] == seen_stamp) {
+            continue;
+        }
+
+        seen[start] = seen_stamp;
+        part[start] = parts;
+        stack.push_back(start);
+
+        while (!stack.empty()) {
+            size_t vertex { stack.back() };
+            stack.pop_back();
+
+            auto visit = [&](size_t reached) {
+                if (mark[reached] == stamp && seen[reached] != seen_stamp) {
+                    seen[reached] = seen_stamp;
+                    part[reached] = parts;
+                    stack.push_back(reached);
+                }
+            };
+
+            forEachOption(vertex, [&](size_t option, size_t) {
+                visit(option);
+
+                for (size_t neighbor : graph.getAdjacencyList(option)) {
+                    visit(neighbor);
+                }
+            });
+        }
+
+        ++parts;
+    }
+
+    return parts;
+}
+
+/**
+ * @brief Resolve separadamente os `parts` grupos independentes do nó atual, do menor para o maior. A relaxação
+ * lagrangiana se decompõe por grupo, então cada grupo é resolvido com o teto `cap` menos o custo já gasto nos grupos
+ * anteriores e o limite inferior dos seguintes.
+ */
+
+size_t Search::solveParts(size_t parts, size_t cap, const std::vector<size_t>& deficient,
+    const std::vector<size_t>& candidates, Labeling& solution) {
+
+    std::vector<std::vector<size_t>> members(parts);
+    std::vector<double> bounds(parts, 0);
+
+    for (size_t vertex : deficient) {
+        members[part[vertex]].push_back(vertex);
+        bounds[part[vertex]] += deficit(vertex) * multipliers[vertex];
+    }
+
+    for (size_t vertex : candidates) {
+        if (!testBit(free, vertex) || reduced_cost[vertex] >= 0) {
+            continue;
+        }
+
+        size_t owner { mark[vertex] == stamp ? vertex : none };
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            if (owner == none && mark[neighbor] == stamp) {
+                owner = neighbor;
+            }
+        }
+
+        bounds[part[owner]] += reduced_cost[vertex];
+    }
+
+    std::vector<size_t> sequence(parts);
+    std::iota(sequence.begin(), sequence.end(), 0);
+    std::sort(sequence.begin(), sequence.end(),
+        [&](size_t a, size_t b) { return members[a].size() < members[b].size(); });
+
+    double remaining { std::accumulate(bounds.begin(), bounds.end(), 0.0) };
+    size_t used {0};
+    Labeling part_solution;
+
+    solution.clear();
+
+    for (size_t index : sequence) {
+        remaining -= bounds[index];
+        size_t others { roundUp(remaining) };
+
+        if (used + others >= cap) {
+            return none;
+        }
+
+        size_t cost { solve(members[index], cap - used - others, part_solution) };
+
+        if (cost == none) {
+            return none;
+        }
+
+        used += cost;
+        solution.insert(solution.end(), part_solution.begin(), part_solution.end());
+    }
+
+    return used;
+}
+
+/**
+ * @brief Ramifica em um vértice livre da vizinhança fechada de `target`, o de menor custo reduzido, fixando-o com 4,
+ * 3, 2 e 0, nessa ordem; cada filho herda como teto o melhor custo encontrado até então.
+ */
+
+size_t Search::branchOn(size_t target, size_t cap, const std::vector<size_t>& deficient, Labeling& solution) {
+    size_t chosen { none };
+
+    forEachOption(target, [&](size_t option, size_t) {
+        if (chosen == none || reduced_cost[option] < reduced_cost[chosen]) {
+            chosen = option;
+        }
+    });
+
+    size_t best_cost { cap };
+    Labeling child_solution;
+
+    for (Gene label : {4, 3, 2}) {
+        if (static_cast<size_t>(label) >= best_cost) {
+            continue;
+        }
+
+        assign(chosen, label);
+        size_t cost { solve(deficient, best_cost - label, child_solution) };
+        unassign(chosen);
+
+        if (cost != none) {
+            best_cost = cost + label;
+            solution = child_solution;
+            solution.emplace_back(chosen, label);
+        }
+    }
+
+    // rótulo 0: o vértice apenas deixa de ser livre.
+    resetBit(free, chosen);
+    size_t cost { solve(deficient, best_cost, child_solution) };
+    setBit(free, chosen);
+
+    if (cost != none) {
+        best_cost = cost;
+        solution = child_solution;
+    }
+
+    return best_cost < cap ? best_cost : none;
+}
+
+/**
+ * @brief Um nó da árvore de busca: satisfaz os vértices com déficit de `scope` com custo menor que `cap`. O nó é
+ * podado quando algum vértice não pode mais ser satisfeito ou quando o limite lagrangiano alcança `cap`; antes de
+ * ramificar, fixa em 0 os candidatos cujo custo reduzido já impede um rótulo positivo e separa os grupos independentes.
+ *
+ * @return O menor custo encontrado, com os rótulos positivos correspondentes em `solution`, ou `none` se nenhuma
+ * solução custa menos que `cap`.
+ */
+
+size_t Search::solve(const std::vector<size_t>& scope, size_t cap, Labeling& solution) {
+    if (node_limit > 0 && nodes >= node_limit) {
+        aborted = true;
+    }
+
+    if (aborted || cap == 0) {
+        return none;
+    }
+
+    ++nodes;
+
+    std::vector<size_t> deficient;
+    size_t target { chooseTarget(scope, deficient) };
+
+    if (target == infeasible) {
+        return none;
+    }
+
+    if (target == none) {
+        solution.clear();
+        return 0;
+    }
+
+    std::vector<size_t> candidates;
+    markDeficient(deficient, candidates);
+
+    // os filhos partem dos multiplicadores deste nó; os do pai são restaurados na saída, para os irmãos.
+    const size_t saved { saved_multipliers.size() };
+    const size_t fixed_before { fixed.size() };
+
+    for (size_t vertex : deficient) {
+        saved_multipliers.emplace_back(vertex, multipliers[vertex]);
+    }
+
+    size_t result { none };
+    double value { lowerBound(node_iterations, cap, deficient, candidates) };
+
+    if (roundUp(value) < cap) {
+        for (size_t vertex : candidates) {
+            if (reduced_cost[vertex] >= 0 && value + reduced_cost[vertex] > cap - 1 + 1e-6) {
+                resetBit(free, vertex);
+                fixed.push_back(vertex);
+            }
+        }
+
+        std::vector<size_t> remaining;
+
+        if (fixed.size() > fixed_before) {
+            target = chooseTarget(deficient, remaining);
+        }
+
+        if (target != infeasible) {
+            size_t parts { split(deficient) };
+
+            result = parts > 1 ? solveParts(parts, cap, deficient, candidates, solution)
+                               : branchOn(target, cap, deficient, solution);
+        }
+    }
+
+    for (; fixed.size() > fixed_before; fixed.pop_back()) {
+        setBit(free, fixed.back());
+    }
+
+    for (; saved_multipliers.size() > saved; saved_multipliers.pop_back()) {
+        multipliers[saved_multipliers.back().first] = saved_multipliers.back().second;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Aplica a redução da raiz e executa a busca. Um vértice com pelo menos duas folhas vizinhas recebe 4 e suas
+ * folhas recebem 0: qualquer FDRT gasta ao menos 4 nesse conjunto, e a troca não piora a cobertura de mais ninguém.
+ *
+ * A relaxação da raiz parte de `initial_multipliers`, os de `LowerBounds`, que usa a mesma redução; o limite da raiz
+ * é o maior entre o seu valor e `known_bound`, o limite de `LowerBounds` para a componente, então nunca é mais fraco.
+ */
+
+void Search::run(const std::vector<double>& initial_multipliers, size_t known_bound) {
+    for (size_t vertex {0}; vertex < order && order >= 3; ++vertex) {
+        size_t leaves {0};
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            leaves += graph.getVertexDegree(neighbor) == 1;
+        }
+
+        if (leaves < 2) {
+            continue;
+        }
+
+        assign(vertex, 4);
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            if (graph.getVertexDegree(neighbor) == 1) {
+                resetBit(free, neighbor);
+            }
+        }
+    }
+
+    std::vector<size_t> scope(order);
+    std::iota(scope.begin(), scope.end(), 0);
+
+    // depois da redução todo vértice ainda pode ser satisfeito.
+    std::vector<size_t> deficient;
+    std::vector<size_t> candidates;
+
+    chooseTarget(scope, deficient);
+    markDeficient(deficient, candidates);
+
+    for (size_t vertex : deficient) {
+        multipliers[vertex] = initial_multipliers[vertex];
+    }
+
+    const size_t cap { best_weight > weight ? best_weight - weight : 0 };
+    root_bound = std::min(std::max(weight + roundUp(lowerBound(root_iterations, cap, deficient, candidates)), known_bound),
+        best_weight);
+
+    Labeling solution;
+    size_t cost { root_bound < best_weight ? solve(scope, cap, solution) : none };
+
+    if (cost != none) {
+        best = labels;
+        best_weight = weight + cost;
+
+        for (const auto& [vertex, label] : solution) {
+            best[vertex] = label;
+        }
+    }
+
+    if (!aborted) {
+        root_bound = best_weight;
+    }
+}
+
+} // namespace
+
+ExactSolver::ExactSolver(const CSRGraph& graph, size_t node_limit, const LowerBounds* bounds)
+    : graph(graph), node_limit(node_limit), bounds(bounds) {}
+
+/**
+ * @brief Resolve cada componente conexa separadamente e junta as soluções. A busca de cada componente parte da
+ * solução da heurística 3 melhorada pela busca local, então mesmo interrompida ela devolve uma FDRT viável, e dos
+ * multiplicadores e do limite da componente em `LowerBounds`.
+ *
+ * @return true se a solução encontrada é comprovadamente ótima, isto é, nenhuma busca atingiu `node_limit`.
+ */
+
+bool ExactSolver::solve() {
+    solution.assign(graph.getOrder(), 0);
+    weight = 0;
+    lower_bound = 0;
+    nodes = 0;
+    optimal = true;
+
+    std::unique_ptr<LowerBounds> own_bounds;
+
+    if (!bounds) {
+        own_bounds = std::make_unique<LowerBounds>(graph);
+    }
+
+    const LowerBounds& relaxation { bounds ? *bounds : *own_bounds };
+    const auto components { graph.components() };
+
+    for (size_t index {0}; index < components.size(); ++index) {
+        const auto& vertices { components[index] };
+        CSRGraph component { graph.subgraph(vertices) };
+        std::vector<double> initial_multipliers(vertices.size());
+
+        for (size_t i {0}; i < vertices.size(); ++i) {
+            initial_multipliers[i] = relaxation.getMultipliers()[vertices[i]];
+        }
+
+        Chromosome incumbent { TripleRomanDomination::heuristic3(component) };
+        localSearch(component, incumbent, 0);
+
+        Search search(component, node_limit, std::move(incumbent.genes));
+        search.run(initial_multipliers, relaxation.getComponentBounds()[index]);
+
+        for (size_t i {0}; i < vertices.size(); ++i) {
+            solution[vertices[i]] = search.best[i];
+        }
+
+        weight += search.best_weight;
+        lower_bound += search.root_bound;
+        nodes += search.nodes;
+        optimal = optimal && !search.aborted;
+    }
+
+    return optimal;
+}
@@ -1,10 +1,13 @@
 #include "GeneticAlgorithm.hpp"
+#include <cstring>
   
 /**
  * @brief Cria uma população de cromossomos com um número específico de genes.
  * 
  * Se funções heurísticas forem fornecidas, os cromossomos são inicializados utilizando essas heurísticas.
- * Caso contrário, uma exceção é lançada.
+ * Caso contrário, uma exceção é lançada. Cada indivíduo é gerado por uma execução própria da heurística, em 
+ * paralelo, com um fluxo aleatório derivado da semente da população, de modo que as heurísticas aleatórias 
+ * produzem indivíduos distintos e o resultado não depende do número de threads.
  * 
  * @param generateChromosomeHeuristics Um vetor de funções heurísticas que geram cromossomos com base em um grafo.
  * @param graph O grafo utilizado para inicializar os cromossomos.
@@ -12,53 +15,41 @@
  *        - `1`: Usa a Heurística 1
  *        - `2`: Usa a Heurística 2
  *        - `3`: Usa a Heurística 3
- *        - `4`: Usa uma combinação das Heurísticas 1, 2 e 3 em proporções iguais.
+ *        - `4`: Usa uma combinação das Heurísticas 1, 2 e 3 em proporções iguais; os indivíduos que sobram da 
+ *               divisão por 3 usam uma heurística sorteada.
  */
 
 void GeneticAlgorithm::createPopulation(
-    std::vector<std::function<Chromosome(const Graph&)>> generateChromosomeHeuristics, 
-    const Graph& graph, 
+    std::vector<std::function<Chromosome(const CSRGraph&)>> generateChromosomeHeuristics, 
+    const CSRGraph& graph, 
     size_t heuristic) {
     
 	if (!generateChromosomeHeuristics.empty()) { 
 	
-		Chromosome func;
-		
-        if (heuristic == 4) { 
-            size_t portion_size { static_cast<size_t>(population_size / 3) };
-			size_t remainder { population_size % 3 }; 
-			size_t index {0};
-			
-			for (size_t i {0}; i < 3; ++i) {		
-		        func = generateChromosomeHeuristics[i](graph);
-		        
-				for (size_t j {0}; j < portion_size; ++j) {
-					this->population[index++] = func;
-				}
-			}
-			
-			for (size_t i {0}; i < remainder; ++i) {
-				this->population[index++] = generateChromosomeHeuristics[getRandomInt(0, 2)](graph);
-			}
-			
-			std::random_device rd;
-			std::mt19937 random_engine(rd());
-			std::shuffle(population.begin(), population.end(), random_engine);	
-
-        } 
+        if (heuristic < 1 || heuristic > 4) { 
+		    throw population;
+        }
         
-        else if (heuristic > 0 && heuristic < 4) {
+        size_t portion_size { static_cast<size_t>(population_size / 3) };
+        uint64_t population_seed { getRandomInt(0, SIZE_MAX) };
+        uint64_t continuation_seed { getRandomInt(0, SIZE_MAX) };
         
-            func = generateChromosomeHeuristics[heuristic - 1](graph);
-            
-            for (size_t i {0}; i < population_size; ++i) {
-                this->population[i] = func;          
-            }
-        }
+        pool->parallelFor(population_size, [&](size_t index) {
+        	TRD_PROFILE_SCOPE(profile);
+        	TRD_PROFILE_PHASE(seeding);
+        	
+        	setRandomSeed(mixSeed(population_seed, index));
+        	
+        	size_t chosen { heuristic - 1 };
+        	
+        	if (heuristic == 4) {
+        		chosen = index < 3 * portion_size ? index % 3 : getRandomInt(0, 2);
+        	}
+        	
+        	this->population[index] = generateChromosomeHeuristics[chosen](graph);
+        });
         
-     	else {
-		    throw population;
-    	}
+        setRandomSeed(continuation_seed);
     } 
 }
 
@@ -67,47 +58,62 @@ void GeneticAlgorithm::createPopulation(
  * **Elitismo:** Seleciona os melhores indivíduos da população com base no menor valor de aptidão (fitness),
  * garantindo que apenas os melhores sejam preservados para a próxima geração.
  * 
- * 1. Ordena a população em ordem crescente de fitness.
- * 2. Mantém apenas os `iterations` melhores indivíduos, onde `iterations` é calculado como uma fração 
- *    do tamanho total da população (`elitism_rate`).
+ * 1. Ordena os índices da população em ordem crescente de fitness (empates pelo índice).
+ * 2. Copia apenas os `iterations` melhores indivíduos para o início da próxima geração, onde `iterations` é 
+ *    calculado como uma fração do tamanho total da população (`elitism_rate`).
  * 
- * @param population     Vetor contendo os cromossomos da população atual.
- * @param elitism_rate   Taxa de elitismo, ajudando a determinar a proporção de indivíduos que serão preservados.
+ * @param population       Vetor contendo os cromossomos da população atual.
+ * @param next_population  Vetor pré-alocado que recebe os sobreviventes; seus genes são sobrescritos sem realocação.
+ * @param elitism_rate     Taxa de elitismo, ajudando a determinar a proporção de indivíduos que serão preservados.
+ * @return O número de indivíduos preservados.
  */
 
-void GeneticAlgorithm::elitism(std::vector<Chromosome>& population, float elitism_rate) {
+size_t GeneticAlgorithm::elitism(const std::vector<Chromosome>& population, std::vector<Chromosome>& next_population, float elitism_rate) {
+    TRD_PROFILE_PHASE(elitism);
+    
     size_t iterations { static_cast<size_t>(std::ceil(population.size() * elitism_rate)) };
 	
-	std::sort(population.begin(), population.end(), 
-            [](const Chromosome& a, const Chromosome& b){
-            	return a.fitness < b.fitness;
+	for (size_t i {0}; i < population.size(); ++i) {
+		ranking[i] = i;
+	}
+	
+	std::partial_sort(ranking.begin(), ranking.begin() + iterations, ranking.end(), 
+            [&](size_t a, size_t b){
+            	return population[a].fitness < population[b].fitness || 
+            		(population[a].fitness == population[b].fitness && a < b);
 	});
 	
-	population.resize(iterations);
+	for (size_t i {0}; i < iterations; ++i) {
+		next_population[i] = population[ranking[i]];
+	}
+	
+	return iterations;
 }
 
 /**
  * **Elitismo por clonagem:** Preserva o melhor indivíduo da população clonando-o múltiplas vezes.
  * 
  * 1. Encontra o melhor indivíduo da população.
- * 2. Remove todos os outros indivíduos.
- * 3. Clona o melhor indivíduo `iterations` vezes para preencher a nova população.
+ * 2. Clona o melhor indivíduo `iterations` vezes no início da próxima geração.
  * 
- * @param population     Vetor contendo os cromossomos da população atual.
- * @param elitism_rate   Taxa de elitismo, ajuda a determinar quantas cópias do melhor indivíduo serão criadas.
+ * @param population       Vetor contendo os cromossomos da população atual.
+ * @param next_population  Vetor pré-alocado que recebe os clones; seus genes são sobrescritos sem realocação.
+ * @param elitism_rate     Taxa de elitismo, ajuda a determinar quantas cópias do melhor indivíduo serão criadas.
+ * @return O número de clones criados.
  */
 
-void GeneticAlgorithm::elitismClones(std::vector<Chromosome>& population, float elitism_rate) {
+size_t GeneticAlgorithm::elitismClones(const std::vector<Chromosome>& population, std::vector<Chromosome>& next_population, float elitism_rate) {
+    TRD_PROFILE_PHASE(elitism);
+    
     size_t iterations { static_cast<size_t>(std::ceil(population.size() * elitism_rate)) };
 	
-	Chromosome best_one { findBestSolution(population) };
-	
-	population.clear();
-	population.reserve(iterations);
+	const Chromosome& best_one { findBestSolution(population) };
 	
 	for (size_t i {0}; i < iterations; ++i) {
-		population.push_back(best_one);
+		next_population[i] = best_one;
 	}
+	
+	return iterations;
 }
 
 /**
@@ -115,7 +121,8 @@ void GeneticAlgorithm::elitismClones(std::vector<Chromosome>& population, float
  * 
  * - Um único gene do cromossomo é selecionado aleatoriamente e recebe um novo valor.
  * - O novo valor é escolhido aleatoriamente dentro do conjunto de rótulos possíveis `{0, 2, 3, 4}`.
- * - Após a mutação, verifica-se se o cromossomo continua viável utilizando a função `feasibilityCheck`.
+ * - Após a mutação, verifica-se se o cromossomo continua viável utilizando a função `feasibilityCheck`,
+ *   restrita à vizinhança fechada do gene alterado.
  * - A mutação ocorre com uma probabilidade definida por `mutation_rate`.
  * 
  * @param chromosome Cromossomo a ser mutado.
@@ -123,13 +130,15 @@ void GeneticAlgorithm::elitismClones(std::vector<Chromosome>& population, float
  */
 
 Chromosome& GeneticAlgorithm::mutation1(Chromosome& chromosome) {	
+	TRD_PROFILE_PHASE(mutation);
+	
 	if (getRandomFloat(0.0, 1.0) < this->mutation_rate) {
-		std::vector<size_t> labels {0, 2, 3, 4};
+		constexpr Gene labels[] {0, 2, 3, 4};
 		size_t randomIndex { getRandomInt(0, genes_size - 1) };
-		short random_label { static_cast<short>(getRandomInt(0, labels.size() - 1)) };
+		short random_label { static_cast<short>(getRandomInt(0, 3)) };
 			
-		chromosome.genes[randomIndex] = labels[random_label];
-		feasibilityCheck(this->graph, chromosome);
+		chromosome.setGene(this->graph, randomIndex, labels[random_label]);
+		feasibilityCheck(this->graph, chromosome, randomIndex);
 	}
 
 	return chromosome;   
@@ -140,7 +149,8 @@ Chromosome& GeneticAlgorithm::mutation1(Chromosome& chromosome) {
  * 
  * - Cada gene do cromossomo tem uma chance de ser mutado, baseada na taxa `mutation_rate`.
  * - Se um gene for selecionado para mutação, ele recebe um novo valor aleatório do conjunto `{0, 2, 3, 4}`.
- * - Após cada mutação, a viabilidade do cromossomo é verificada usando `feasibilityCheck`.
+ * - Após cada mutação, a viabilidade do cromossomo é verificada usando `feasibilityCheck`, restrita à 
+ *   vizinhança fechada do gene alterado.
  * - Essa abordagem permite um maior grau de variação na população genética.
  * 
  * @param chromosome Cromossomo a ser mutado.
@@ -148,13 +158,15 @@ Chromosome& GeneticAlgorithm::mutation1(Chromosome& chromosome) {
  */
 
 Chromosome& GeneticAlgorithm::mutation2(Chromosome& chromosome) {	
+	TRD_PROFILE_PHASE(mutation);
+	
 	for (size_t i {0}; i < chromosome.genes.size(); ++i) {
 		if (getRandomFloat(0.0, 1.0) < this->mutation_rate) {
-			std::vector<size_t> labels {0, 2, 3, 4};
-			short random_label { static_cast<short>(getRandomInt(0, labels.size() - 1)) };
+			constexpr Gene labels[] {0, 2, 3, 4};
+			short random_label { static_cast<short>(getRandomInt(0, 3)) };
 				
-			chromosome.genes[i] = labels[random_label];
-			feasibilityCheck(this->graph, chromosome);
+			chromosome.setGene(this->graph, i, labels[random_label]);
+			feasibilityCheck(this->graph, chromosome, i);
 		}
 	}
 	
@@ -162,6 +174,101 @@ Chromosome& GeneticAlgorithm::mutation2(Chromosome& chromosome) {
 }
 
 
+/**
+ * Troca os genes do intervalo `[first, last)` entre dois cromossomos, mantendo seus fitness atualizados. 
+ * Os genes são comparados e trocados de 8 em 8 (uma palavra de 64 bits por vez); só as posições com rótulos 
+ * diferentes são registradas em `changed_vertices`, para que apenas suas vizinhanças sejam reparadas.
+ */
+
+void GeneticAlgorithm::swapGeneRange(Chromosome& chromosome1, Chromosome& chromosome2, size_t first, size_t last, 
+	std::vector<size_t>& changed_vertices) {
+	
+	if (chromosome1.hasNeighborhoodCache() || chromosome2.hasNeighborhoodCache()) {
+		for (size_t i {first}; i < last; ++i) {
+			Gene label1 { chromosome1.genes[i] };
+			Gene label2 { chromosome2.genes[i] };
+			
+			if (label1 != label2) {
+				chromosome1.setGene(graph, i, label2);
+				chromosome2.setGene(graph, i, label1);
+				changed_vertices.push_back(i);
+			}
+		}
+		
+		return;
+	}
+	
+	Gene* genes1 { chromosome1.genes.data() };
+	Gene* genes2 { chromosome2.genes.data() };
+	int64_t delta {0};
+	size_t i {first};
+	
+	for (; i + sizeof(uint64_t) <= last; i += sizeof(uint64_t)) {
+		uint64_t word1 {0};
+		uint64_t word2 {0};
+		
+		std::memcpy(&word1, genes1 + i, sizeof(uint64_t));
+		std::memcpy(&word2, genes2 + i, sizeof(uint64_t));
+		
+		if (word1 == word2) { continue; }
+		
+		for (size_t j {i}; j < i + sizeof(uint64_t); ++j) {
+			if (genes1[j] != genes2[j]) {
+				delta += static_cast<int64_t>(genes2[j]) - genes1[j];
+				changed_vertices.push_back(j);
+			}
+		}
+		
+		std::memcpy(genes1 + i, &word2, sizeof(uint64_t));
+		std::memcpy(genes2 + i, &word1, sizeof(uint64_t));
+	}
+	
+	for (; i < last; ++i) {
+		if (genes1[i] != genes2[i]) {
+			delta += static_cast<int64_t>(genes2[i]) - genes1[i];
+			changed_vertices.push_back(i);
+			std::swap(genes1[i], genes2[i]);
+		}
+	}
+	
+	chromosome1.fitness += delta;
+	chromosome2.fitness -= delta;
+}
+
+/**
+ * Gera os dois filhos da troca do intervalo `[first, last)` entre os pais, repara apenas as vizinhanças dos 
+ * genes alterados e deixa o melhor deles em `offspring`. O segundo filho usa um cromossomo auxiliar por thread, 
+ * e a escolha é feita trocando os buffers, de modo que nenhuma memória é alocada após a primeira geração.
+ */
+
+Chromosome& GeneticAlgorithm::crossOverRange(const Chromosome& chromosome1, const Chromosome& chromosome2, 
+	size_t first, size_t last, Chromosome& offspring) {
+	
+	TRD_PROFILE_PHASE(crossover);
+	
+	thread_local Chromosome sibling;
+	thread_local std::vector<size_t> changed_vertices;
+	
+	{
+		TRD_PROFILE_PHASE(copy);
+		offspring = chromosome1;
+		sibling = chromosome2;
+	}
+	
+	changed_vertices.clear();
+	
+	swapGeneRange(offspring, sibling, first, last, changed_vertices);
+	
+	feasibilityCheck(this->graph, offspring, changed_vertices);
+	feasibilityCheck(this->graph, sibling, changed_vertices);
+	
+	if (&chooseBestSolution(offspring, sibling) != &offspring) {
+		std::swap(offspring, sibling);
+	}
+	
+	return offspring;
+}
+
 /**
  * **Cruzamento de um ponto (one-point crossover)**: 
  * Uma posição aleatória é selecionada no vetor de genes. Todos os genes a partir essa posição 
@@ -169,24 +276,15 @@ Chromosome& GeneticAlgorithm::mutation2(Chromosome& chromosome) {
  * 
  * @param chromosome1 Primeiro cromossomo pai.
  * @param chromosome2 Segundo cromossomo pai.
+ * @param offspring   Cromossomo pré-alocado que recebe o melhor filho resultante do cruzamento.
  * @return O melhor cromossomo resultante do cruzamento.
  */
 
-Chromosome GeneticAlgorithm::onePointCrossOver(const Chromosome& chromosome1, const Chromosome& chromosome2) {
+Chromosome& GeneticAlgorithm::onePointCrossOver(const Chromosome& chromosome1, const Chromosome& chromosome2, Chromosome& offspring) {
   
    size_t index { getRandomInt(0, genes_size - 1) };
    
-   Chromosome solution1 { chromosome1 };
-   Chromosome solution2 { chromosome2 };
-    
-   for(size_t i {index + 1}; i <= genes_size - 1; ++i) {
-		std::swap(solution1.genes[i], solution2.genes[i]);
-   }
-   
-   feasibilityCheck(this->graph, solution1);
-   feasibilityCheck(this->graph, solution2);
-    
-   return chooseBestSolution(solution1, solution2);
+   return this->crossOverRange(chromosome1, chromosome2, index + 1, genes_size, offspring);
 }
 
 /**
@@ -196,28 +294,19 @@ Chromosome GeneticAlgorithm::onePointCrossOver(const Chromosome& chromosome1, co
  * 
  * @param chromosome1 Primeiro cromossomo pai.
  * @param chromosome2 Segundo cromossomo pai.
+ * @param offspring   Cromossomo pré-alocado que recebe o melhor filho resultante do cruzamento.
  * @return O melhor cromossomo resultante do cruzamento.
  */
 
-Chromosome GeneticAlgorithm::twoPointCrossOver(const Chromosome& chromosome1, const Chromosome& chromosome2) {
+Chromosome& GeneticAlgorithm::twoPointCrossOver(const Chromosome& chromosome1, const Chromosome& chromosome2, Chromosome& offspring) {
 	size_t range1 { getRandomInt(0, genes_size - 1) };
 	size_t range2 { getRandomInt(0, genes_size - 1) };
 
-	Chromosome solution1 { chromosome1 };
-	Chromosome solution2 { chromosome2 };
-
 	if (range1 > range2) {
 		std::swap(range1, range2);
 	}
 
-	for (size_t i {range1}; i <= range2; ++i) {
-		std::swap(solution1.genes[i], solution2.genes[i]);
-	}
-	
-	feasibilityCheck(this->graph, solution1);
-	feasibilityCheck(this->graph, solution2);
-
-	return chooseBestSolution(solution1, solution2);
+	return this->crossOverRange(chromosome1, chromosome2, range1, range2 + 1, offspring);
 }
 
 /**
@@ -233,20 +322,16 @@ Chromosome GeneticAlgorithm::twoPointCrossOver(const Chromosome& chromosome1, co
  */
 
 const Chromosome& GeneticAlgorithm::tournamentSelection(const std::vector<Chromosome>& population, size_t individuals_size) {  
-    std::vector<size_t> tournament_individuals_indices; 
-    tournament_individuals_indices.reserve(individuals_size);
+    TRD_PROFILE_PHASE(selection);
+    
+    size_t best_index { getRandomInt(0, population.size() - 1) };
     size_t random_index {0};
     
-    for (size_t i {0}; i < individuals_size; ++i) {
+    for (size_t i {1}; i < individuals_size; ++i) {
         random_index = getRandomInt(0, population.size() - 1);
-        tournament_individuals_indices.push_back(random_index);
-    }
-	
-    size_t best_index = tournament_individuals_indices[0];
-	
-    for (auto index : tournament_individuals_indices) {
-        if (population[index].fitness < population[best_index].fitness) {
-            best_index = index;
+        
+        if (population[random_index].fitness < population[best_index].fitness) {
+            best_index = random_index;
         }
     }
 		
@@ -257,16 +342,16 @@ Chromosome& GeneticAlgorithm::chooseBestSolution(Chromosome& chromosome1, Chromo
     return (chromosome1.fitness < chromosome2.fitness ? chromosome1 : chromosome2);
 }
 
-Chromosome GeneticAlgorithm::findBestSolution(const std::vector<Chromosome>& population) { 
-	Chromosome best_solution { population[0] };
+const Chromosome& GeneticAlgorithm::findBestSolution(const std::vector<Chromosome>& population) { 
+	size_t best_index {0};
 
-	for (const auto& chromosome: population) {
-		if (best_solution.fitness > chromosome.fitness) {
-			best_solution = chromosome;
+	for (size_t i {1}; i < population.size(); ++i) {
+		if (population[best_index].fitness > population[i].fitness) {
+			best_index = i;
 		}
 	}
 
-	return best_solution; 
+	return population[best_index]; 
 }
 
 /**
@@ -280,8 +365,11 @@ Chromosome GeneticAlgorithm::findBestSolution(const std::vector<Chromosome>& pop
  *    ou de um ponto, dependendo da configuração.
  * 4. **Mutação**: Introduz variações no cromossomo gerado para aumentar a diversidade genética. Pode ser aplicada 
  *    uma mutação de um ponto ou uma mutação linear.
- * 5. **Atualização da população**: A nova geração é formada a partir dos indivíduos resultantes dessas operações, garantindo 
- *    que a população mantenha um tamanho constante.
+ * 5. **Busca local** (opcional): Em gerações escolhidas por `setLocalSearch`, parte da prole é melhorada por 
+ *    `localSearch`, que reduz rótulos mantendo a viabilidade.
+ * 6. **Atualização da população**: A nova geração é formada a partir dos indivíduos resultantes dessas operações, garantindo 
+ *    que a população mantenha um tamanho constante. As posições da prole são pré-alocadas e preenchidas em paralelo 
+ *    pelas threads do algoritmo.
  * 
  * @param flag_elitism   Indica qual estratégia de elitismo será aplicada.
  * @param flag_selection Define o método de seleção (torneio ou aleatório).
@@ -292,37 +380,46 @@ Chromosome GeneticAlgorithm::findBestSolution(const std::vector<Chromosome>& pop
 
 
 std::vector<Chromosome>& GeneticAlgorithm::createNewPopulation(bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
-	std::vector<Chromosome> old_population = population;
+	TRD_PROFILE_SCOPE(profile);
+	
+	size_t survivors {0};
 	
    	if (flag_elitism == true) {  		
-   		this->elitism(population, elitism_rate);
+   		survivors = this->elitism(population, next_population, elitism_rate);
    	}
    	
    	else {
-   		this->elitismClones(population, elitism_rate);
+   		survivors = this->elitismClones(population, next_population, elitism_rate);
    	}
     
-    Chromosome selected1;
-    Chromosome selected2;
-    Chromosome offspring;
+    // cada posição da prole usa seu próprio fluxo aleatório, derivado da semente da geração, de modo que o 
+    // resultado não depende de quantas threads geram a prole nem da ordem em que terminam.
+    uint64_t offspring_seed { getRandomInt(0, SIZE_MAX) };
+    uint64_t continuation_seed { getRandomInt(0, SIZE_MAX) };
     
-    while (population.size() < population_size) {
-       	if (flag_selection == true) {  		
-        	selected1 = tournamentSelection(old_population, tournament_population_size);
-        	selected2 = tournamentSelection(old_population, tournament_population_size);
-        }
-        
-        else {
-    		selected1 = old_population[getRandomInt(0, old_population.size() - 1)];
-    		selected2 = old_population[getRandomInt(0, old_population.size() - 1)];
-        }
-
+    bool apply_local_search { local_search.rate > 0.0f && generation % std::max<size_t>(local_search.interval, 1) == 0 };
+    
+    pool->parallelFor(next_population.size() - survivors, [&](size_t slot) {
+    	TRD_PROFILE_SCOPE(profile);
+    	
+    	setRandomSeed(mixSeed(offspring_seed, slot));
+    	
+       	const Chromosome& selected1 { flag_selection ? 
+       		tournamentSelection(population, tournament_population_size) :
+       		population[getRandomInt(0, population.size() - 1)] };
+       		
+       	const Chromosome& selected2 { flag_selection ? 
+       		tournamentSelection(population, tournament_population_size) :
+       		population[getRandomInt(0, population.size() - 1)] };
+
+		Chromosome& offspring { next_population[survivors + slot] };
+		
        	if (flag_crossover == true) {  		
-        	offspring = this->twoPointCrossOver(selected1, selected2);
+        	this->twoPointCrossOver(selected1, selected2, offspring);
 		} 
         
 		else {      
-        	offspring = this->onePointCrossOver(selected1, selected2);     
+        	this->onePointCrossOver(selected1, selected2, offspring);     
     	}
     	
     	if (flag_mutation == true) {  		
@@ -333,8 +430,18 @@ std::vector<Chromosome>& GeneticAlgorithm::createNewPopulation(bool flag_elitism
 	    	mutation2(offspring);	    
     	}
     	
-        population.emplace_back(offspring);       
-    }
+    	if (apply_local_search && getRandomFloat(0.0f, 1.0f) < local_search.rate) {
+    		TRD_PROFILE_PHASE(local_search);
+    		localSearch(graph, offspring, local_search.budget);
+    	}
+    });
+    
+    setRandomSeed(continuation_seed);
+    
+    this->evaluations += next_population.size() - survivors;
+    
+    // a geração atual vira o buffer da próxima; os cromossomos são reaproveitados, sem realocação.
+    this->population.swap(next_population);
     
     return population;
 }
@@ -349,59 +456,228 @@ size_t GeneticAlgorithm::getFitnessMean() { return fitness_mean; }
 
 size_t GeneticAlgorithm::getFitnessSTD() { return fitness_std; }
 
-// retorna uma tupla contendo: melhor fitness, média e desvio padrão de fitness, respectivamente.
+PopulationDiversity GeneticAlgorithm::getInitialDiversity() { return initial_diversity; }
 
-std::tuple<size_t, float, float> GeneticAlgorithm::run(size_t generations, 
-    std::vector<std::function<Chromosome(const Graph&)>> heuristics, 
-    size_t chosen_heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) { 
+size_t GeneticAlgorithm::getCurrentGeneration() { return generation; }
+
+bool GeneticAlgorithm::hasPopulation() { return has_population; }
+
+void GeneticAlgorithm::setStoppingCriteria(const StoppingCriteria& criteria) { stopping_criteria = criteria; }
+
+void GeneticAlgorithm::setLocalSearch(const LocalSearchSettings& settings) { local_search = settings; }
+
+StopReason GeneticAlgorithm::getStopReason() { return stop_reason; }
+
+size_t GeneticAlgorithm::getEvaluations() { return evaluations; }
+
+const std::vector<ProfileSnapshot>& GeneticAlgorithm::getGenerationProfiles() { return generation_profiles; }
+
+const char* stopReasonName(StopReason reason) {
+	switch (reason) {
+		case StopReason::stagnation: return "stagnation";
+		case StopReason::lower_bound: return "lower_bound";
+		case StopReason::time_limit: return "time_limit";
+		case StopReason::evaluations: return "evaluations";
+		default: return "generations";
+	}
+}
+
+/**
+ * Verifica os critérios de parada antecipada e, se algum foi atingido, registra-o em `stop_reason`. 
+ * Os critérios são testados na ordem: limite inferior, estagnação, avaliações e tempo.
+ */
+
+bool GeneticAlgorithm::shouldStop() {
+	const StoppingCriteria& criteria { stopping_criteria };
 	
-    this->createPopulation(heuristics, graph, chosen_heuristic);
-   
-    Chromosome current_best_solution { findBestSolution(population) };  
-    Chromosome best_solution { current_best_solution };
-    size_t generation {0};
+	if (criteria.lower_bound > 0 && best_fitness <= criteria.lower_bound) {
+		stop_reason = StopReason::lower_bound;
+	}
+	
+	else if (criteria.stagnation_generations > 0 && generation - last_improvement >= criteria.stagnation_generations) {
+		stop_reason = StopReason::stagnation;
+	}
+	
+	else if (criteria.max_evaluations > 0 && evaluations >= criteria.max_evaluations) {
+		stop_reason = StopReason::evaluations;
+	}
+	
+	else if (criteria.time_limit > 0.0 && 
+			std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count() >= criteria.time_limit) {
+		stop_reason = StopReason::time_limit;
+	}
+	
+	else {
+		return false;
+	}
+	
+	return true;
+}
 
-    size_t best_fitness { best_solution.fitness };
-    float fitness_mean {0.0f};
-    float fitness_std {0.0f};
+/**
+ * Com TRD_INSTRUMENTATION, guarda os tempos e contadores acumulados desde o registro anterior como os de uma geração 
+ * e recomeça a contagem; sem ela, não faz nada.
+ */
 
-    while (generation < generations) {
-        this->population.swap(createNewPopulation(flag_elitism, flag_selection, flag_crossover, flag_mutation));
-        
-        current_best_solution = findBestSolution(population);  
+void GeneticAlgorithm::recordProfile() {
+#ifdef TRD_INSTRUMENTATION
+	auto now { std::chrono::steady_clock::now() };
+	
+	generation_profiles.push_back(profile.snapshot());
+	generation_profiles.back().elapsed_nanoseconds = 
+		std::chrono::duration_cast<std::chrono::nanoseconds>(now - profile_start).count();
+	
+	profile.reset();
+	profile_start = now;
+#endif
+}
 
-        if (best_solution.fitness > current_best_solution.fitness) {
-            best_solution = current_best_solution;       
-            best_fitness = current_best_solution.fitness;
-        }
+/**
+ * Cria a população inicial com as heurísticas e reinicia o estado da execução (melhor solução, contador 
+ * de gerações e fluxo aleatório, derivado da semente do algoritmo).
+ */
 
-        // Cálculo da média da aptidão
-        float sum_fitness = 0.0f;
-        for (const auto& individual : population) {
-            sum_fitness += individual.fitness;
-        }
-        
-        fitness_mean = sum_fitness / population.size();
+void GeneticAlgorithm::initialize(std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics, size_t chosen_heuristic) {
+	this->start_time = std::chrono::steady_clock::now();
+	this->profile_start = start_time;
+	this->profile.reset();
+	this->generation_profiles.clear();
+	
+	// toda a execução deriva da semente do algoritmo, independentemente da thread em que ele roda.
+	setRandomSeed(seed);
+	
+    this->createPopulation(heuristics, graph, chosen_heuristic);
+    
+    this->initial_diversity = populationDiversity(population);
+    this->random_state = getRandomEngine();
+    this->next_population.assign(std::max(population_size, population.size()), Chromosome(genes_size));
+    this->ranking.resize(population.size());
+    this->best_solution = findBestSolution(population);
+    this->best_fitness = best_solution.fitness;
+    fitnessStatistics(population, fitness_mean, fitness_std);
+    this->generation = 0;
+    this->last_improvement = 0;
+    this->evaluations = population.size();
+    this->stop_reason = StopReason::generations;
+    this->has_population = true;
+    
+    recordProfile();
+}
 
-        // Cálculo da variância
-        float variance = 0.0f;
-        for (const auto& individual : population) {
-            variance += std::pow(individual.fitness - fitness_mean, 2);
-        }
+/**
+ * Continua a evolução da população atual por mais `generations` gerações, sem recriá-la. O fluxo aleatório 
+ * continua de onde a chamada anterior parou, então evoluir N + M gerações em duas chamadas dá o mesmo resultado 
+ * que em uma só. A evolução termina antes se um dos critérios de `setStoppingCriteria` for atingido; o critério 
+ * fica em `getStopReason`.
+ *
+ * retorna uma tupla contendo: melhor fitness, média e desvio padrão de fitness, respectivamente.
+ */
+
+std::tuple<size_t, float, float> GeneticAlgorithm::evolve(size_t generations, 
+	bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
+	
+	if (!has_population) {
+		throw std::logic_error("GeneticAlgorithm::evolve called before initialize");
+	}
+	
+	getRandomEngine() = random_state;
+	
+	size_t last_generation { generation + generations };
+	stop_reason = StopReason::generations;
+
+    while (generation < last_generation && !shouldStop()) {
+        this->createNewPopulation(flag_elitism, flag_selection, flag_crossover, flag_mutation);
         
-        variance /= population.size();
+        {
+            TRD_PROFILE_SCOPE(profile);
+            TRD_PROFILE_PHASE(statistics);
+            
+            const Chromosome& current_best_solution { findBestSolution(population) };  
 
-        // Cálculo do desvio padrão
-        fitness_std = std::sqrt(variance);
+            if (best_solution.fitness > current_best_solution.fitness) {
+                best_solution = current_best_solution;       
+                best_fitness = current_best_solution.fitness;
+                last_improvement = generation + 1;
+            }
+
+            // média e desvio padrão da aptidão, em uma única passada
+            fitnessStatistics(population, fitness_mean, fitness_std);
+        }
 
         ++generation;
+        recordProfile();
     }  
+    
+    random_state = getRandomEngine();
+
+    return {static_cast<size_t>(best_fitness), fitness_mean, fitness_std};
+}
+
+/**
+ * Copia para `individuals` os `count` melhores indivíduos da população atual, do melhor para o pior; usada para 
+ * escolher os emigrantes do modelo de ilhas. Os cromossomos de `individuals` são reaproveitados entre chamadas.
+ */
+
+void GeneticAlgorithm::getBestIndividuals(size_t count, std::vector<Chromosome>& individuals) {
+	count = std::min(count, population.size());
 	
-    this->best_solution.swap(best_solution.genes);
+	for (size_t i {0}; i < population.size(); ++i) {
+		ranking[i] = i;
+	}
+	
+	std::partial_sort(ranking.begin(), ranking.begin() + count, ranking.end(), 
+            [&](size_t a, size_t b){
+            	return population[a].fitness < population[b].fitness || 
+            		(population[a].fitness == population[b].fitness && a < b);
+	});
+	
+	individuals.resize(count);
+	
+	for (size_t i {0}; i < count; ++i) {
+		individuals[i] = population[ranking[i]];
+	}
+}
+
+/**
+ * Substitui os piores indivíduos da população atual pelos de `individuals` (os imigrantes do modelo de ilhas) e 
+ * atualiza a melhor solução, caso algum deles seja melhor.
+ */
+
+void GeneticAlgorithm::replaceWorstIndividuals(const std::vector<Chromosome>& individuals) {
+	size_t count { std::min(individuals.size(), population.size()) };
+	
+	for (size_t i {0}; i < population.size(); ++i) {
+		ranking[i] = i;
+	}
+	
+	std::partial_sort(ranking.begin(), ranking.begin() + count, ranking.end(), 
+            [&](size_t a, size_t b){
+            	return population[a].fitness > population[b].fitness || 
+            		(population[a].fitness == population[b].fitness && a < b);
+	});
+	
+	for (size_t i {0}; i < count; ++i) {
+		population[ranking[i]] = individuals[i];
+		
+		if (best_solution.fitness > individuals[i].fitness) {
+			best_solution = individuals[i];
+			best_fitness = individuals[i].fitness;
+			last_improvement = generation;
+		}
+	}
+}
 
-    return {best_fitness, fitness_mean, fitness_std};
+// cria a população inicial e a evolui por `generations` gerações.
+
+std::tuple<size_t, float, float> GeneticAlgorithm::run(size_t generations, 
+    std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics, 
+    size_t chosen_heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) { 
+	
+	this->initialize(heuristics, chosen_heuristic);
+	
+	return this->evolve(generations, flag_elitism, flag_selection, flag_crossover, flag_mutation);
 }
 
-std::vector<int> GeneticAlgorithm::getBestSolution() {
-	return best_solution;
+std::vector<Gene> GeneticAlgorithm::getBestSolution() {
+	return best_solution.genes;
 }		      
@@ -1,42 +1,5 @@
 #include "Graph.hpp"
-
-Graph::Graph(size_t order, float probabilityOfEdge) {
-    this->order = order;
-    this->size = 0;
-
-    size_t connectedVertex = 0;
-    float probability = 0.0;
-
-    std::random_device randomNumber;
-    std::mt19937 seed(randomNumber());
-    std::uniform_int_distribution<int> gap(0, order - 1);
-    std::uniform_real_distribution<float> probabilityGap(0.0, 1.0);
-
-    for (size_t i = 0; i < order; ++i) {
-        adjList[i] = {};
-    }
-
-    for (size_t i = 0; i < order; ++i) {
-        connectedVertex = gap(seed);
-
-        while (i == connectedVertex) {
-            connectedVertex = gap(seed);
-		}
-		
-        if (!edgeExists(i, connectedVertex)) {
-            addEdge(i, connectedVertex);
-        }
-
-        for (size_t j = i + 1; j < order; ++j) {
-            if (!edgeExists(i, j)) {
-                probability = probabilityGap(seed);
-                if (probabilityOfEdge >= probability) {
-                    addEdge(i, j);
-                }
-           }
-        }
-    }
-}
+#include "CSRGraph.hpp"
 
 Graph::Graph(const std::string& filename): 
 	order(0), size(0) {
@@ -66,6 +29,7 @@ Graph::Graph(const std::string& filename):
 
 Graph::Graph(const Graph& graph): order(graph.order), size(graph.size), adjList(graph.adjList) {}
 
+
 void Graph::addVertex(size_t source) {
 	if (!vertexExists(source)) {
         adjList[source] = {};
@@ -81,24 +45,7 @@ void Graph::addEdge(size_t source, size_t destination) {
     this->size += 1;
 }
 
-void Graph::DFSVisit(size_t u, std::vector<bool>& discovered, size_t& numberOfVertices, size_t& minDegree) {
-    discovered[u] = true;
-
-    if (getVertexDegree(u) < static_cast<size_t>(minDegree)) { 
-        minDegree = getVertexDegree(u);
-    }
 
-    for (const size_t& v : getAdjacencyList(u)) {
-        if (!discovered[v]) {
-            ++numberOfVertices;
-            if (getVertexDegree(v) < static_cast<size_t>(minDegree)) {
-                minDegree = getVertexDegree(v);
-            }
-            
-            DFSVisit(v, discovered, numberOfVertices, minDegree);
-        }
-    }
-}
 
 size_t Graph::computeMaxVertexDegree() const {
 	if (getAdjacencyList().empty()) { return 0; }
@@ -159,24 +106,23 @@ bool Graph::edgeExists(size_t u, size_t v) const {
 
 bool Graph::vertexExists(size_t vertex) const { return adjList.find(vertex) != adjList.end(); }
 
+// os componentes são encontrados sobre a cópia CSR, que numera os vértices de 0 a n-1 (os ids podem ser maiores 
+// que a ordem do grafo) e não usa recursão, de modo que caminhos longos não estouram a pilha.
+
 std::vector<std::pair<int, int>> Graph::connectedComponents() {
-    std::vector<bool> discovered(getOrder(), false);
     std::vector<std::pair<int, int>> components;
-
-    for (const auto& [u, _] : adjList) {
-        size_t vertex = u;
-        if (!discovered[vertex]) {
-            size_t numberOfVertices = 1;
-            size_t minDegree = std::numeric_limits<int>::max();
-            DFSVisit(vertex, discovered, numberOfVertices, minDegree);
-            components.push_back({numberOfVertices, minDegree});
-        }
+    
+    for (const auto& [order, min_degree] : CSRGraph(*this).connectedComponents()) {
+        components.push_back({static_cast<int>(order), static_cast<int>(min_degree)});
     }
+    
     return components;
 }
 
 void Graph::deleteVertex(size_t vertex) {
-    for (auto& [v, neighbors] : this->adjList) {
+    // só as listas dos vizinhos podem conter `vertex`.
+    for (const auto& neighbor : this->adjList[vertex]) {
+        auto& neighbors { this->adjList[neighbor] };
         neighbors.erase(std::remove(neighbors.begin(), neighbors.end(), vertex), neighbors.end());
     }
 
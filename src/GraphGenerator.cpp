@@ -0,0 +1,257 @@
+#include "GraphGenerator.hpp"
+#include "Random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+// Keeps the first occurrence of every unordered pair in `endpoints`. Pairs are bucketed by their smaller endpoint
+// with a counting sort and repeated larger endpoints are found with a stamp per vertex, so this takes O(n + m).
+
+static void removeDuplicateEdges(size_t order, std::vector<size_t>& endpoints) {
+    std::vector<size_t> first(order + 1, 0);
+
+    for (size_t i {0}; i < endpoints.size(); i += 2) {
+        ++first[std::min(endpoints[i], endpoints[i + 1]) + 1];
+    }
+
+    for (size_t i {0}; i < order; ++i) {
+        first[i + 1] += first[i];
+    }
+
+    std::vector<size_t> larger(endpoints.size() / 2);
+    std::vector<size_t> next(first.begin(), first.end() - 1);
+
+    for (size_t i {0}; i < endpoints.size(); i += 2) {
+        larger[next[std::min(endpoints[i], endpoints[i + 1])]++] = std::max(endpoints[i], endpoints[i + 1]);
+    }
+
+    std::vector<size_t> stamp(order, SIZE_MAX);
+    endpoints.clear();
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        for (size_t i {first[vertex]}; i < first[vertex + 1]; ++i) {
+            if (stamp[larger[i]] != vertex) {
+                stamp[larger[i]] = vertex;
+                endpoints.push_back(vertex);
+                endpoints.push_back(larger[i]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief G(n, p) graph: every pair of vertices is joined independently with probability `probability`.
+ *
+ * The pairs are enumerated with the geometric skips of Batagelj and Brandes, so only the generated edges are
+ * visited. As in the original generator, every vertex is also joined to one uniformly chosen partner, so no
+ * vertex is isolated.
+ */
+
+CSRGraph generateErdosRenyiGraph(size_t order, double probability, uint64_t seed) {
+    std::vector<size_t> endpoints;
+
+    if (order < 2) {
+        return CSRGraph(order, endpoints);
+    }
+
+    Xoshiro256 generator(seed);
+    std::uniform_int_distribution<size_t> partner_gap(0, order - 2);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    const double pairs { static_cast<double>(order) * (order - 1) / 2 };
+    endpoints.reserve(2 * static_cast<size_t>(std::min(pairs, std::max(0.0, probability) * pairs) + order));
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        size_t partner { partner_gap(generator) };
+
+        endpoints.push_back(vertex);
+        endpoints.push_back(partner >= vertex ? partner + 1 : partner);
+    }
+
+    if (probability >= 1.0) {
+        for (size_t vertex {1}; vertex < order; ++vertex) {
+            for (size_t neighbor {0}; neighbor < vertex; ++neighbor) {
+                endpoints.push_back(vertex);
+                endpoints.push_back(neighbor);
+            }
+        }
+    }
+
+    else if (probability > 0.0) {
+        const double log_complement { std::log(1.0 - probability) };
+        size_t vertex {1};
+        size_t neighbor {0};
+        bool first_pair {true};
+
+        // `neighbor` walks the pairs (vertex, 0..vertex-1) row by row, skipping the pairs that are not drawn.
+        while (vertex < order) {
+            double skip { std::floor(std::log(1.0 - unit(generator)) / log_complement) };
+            size_t advance { static_cast<size_t>(std::min(skip, pairs)) + (first_pair ? 0 : 1) };
+            first_pair = false;
+
+            while (vertex < order && advance >= vertex - neighbor) {
+                advance -= vertex - neighbor;
+                neighbor = 0;
+                ++vertex;
+            }
+
+            if (vertex < order) {
+                neighbor += advance;
+                endpoints.push_back(vertex);
+                endpoints.push_back(neighbor);
+            }
+        }
+    }
+
+    removeDuplicateEdges(order, endpoints);
+
+    return CSRGraph(order, std::move(endpoints));
+}
+
+/**
+ * @brief Barabási–Albert preferential attachment graph: starting from a clique on `attachment + 1` vertices,
+ * every new vertex is joined to `attachment` distinct vertices chosen with probability proportional to their
+ * degree.
+ *
+ * A vertex appears in the edge list once per incident edge, so drawing a uniform position of that list is a
+ * degree-proportional draw.
+ */
+
+CSRGraph generateBarabasiAlbertGraph(size_t order, size_t attachment, uint64_t seed) {
+    attachment = std::max<size_t>(attachment, 1);
+
+    Xoshiro256 generator(seed);
+    std::vector<size_t> endpoints;
+    std::vector<size_t> targets;
+    const size_t clique_order { std::min(order, attachment + 1) };
+
+    endpoints.reserve(2 * (clique_order * clique_order / 2 + (order - clique_order) * attachment));
+
+    for (size_t vertex {1}; vertex < clique_order; ++vertex) {
+        for (size_t neighbor {0}; neighbor < vertex; ++neighbor) {
+            endpoints.push_back(vertex);
+            endpoints.push_back(neighbor);
+        }
+    }
+
+    for (size_t vertex {clique_order}; vertex < order; ++vertex) {
+        std::uniform_int_distribution<size_t> gap(0, endpoints.size() - 1);
+        targets.clear();
+
+        while (targets.size() < attachment) {
+            size_t target { endpoints[gap(generator)] };
+
+            if (std::find(targets.begin(), targets.end(), target) == targets.end()) {
+                targets.push_back(target);
+            }
+        }
+
+        for (const auto& target : targets) {
+            endpoints.push_back(vertex);
+            endpoints.push_back(target);
+        }
+    }
+
+    return CSRGraph(order, std::move(endpoints));
+}
+
+/**
+ * @brief Random geometric graph: `order` points are placed uniformly in the unit square and every pair closer than
+ * `radius` is joined.
+ *
+ * Points are bucketed into square cells at least `radius` wide, so each point is only compared with the points of
+ * its own cell and of the adjacent cells.
+ */
+
+CSRGraph generateGeometricGraph(size_t order, double radius, uint64_t seed) {
+    std::vector<size_t> endpoints;
+
+    if (order < 2 || radius <= 0.0) {
+        return CSRGraph(order, endpoints);
+    }
+
+    Xoshiro256 generator(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::vector<double> x(order);
+    std::vector<double> y(order);
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        x[vertex] = unit(generator);
+        y[vertex] = unit(generator);
+    }
+
+    const size_t side { static_cast<size_t>(std::max(1.0, 
+        std::min(std::floor(1.0 / radius), std::ceil(std::sqrt(static_cast<double>(order)))))) };
+
+    auto cellOf = [&](size_t vertex) {
+        size_t column { std::min(side - 1, static_cast<size_t>(x[vertex] * side)) };
+        size_t row { std::min(side - 1, static_cast<size_t>(y[vertex] * side)) };
+        return row * side + column;
+    };
+
+    std::vector<size_t> first(side * side + 1, 0);
+    std::vector<size_t> points(order);
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        ++first[cellOf(vertex) + 1];
+    }
+
+    for (size_t cell {0}; cell < side * side; ++cell) {
+        first[cell + 1] += first[cell];
+    }
+
+    std::vector<size_t> next(first.begin(), first.end() - 1);
+
+    for (size_t vertex {0}; vertex < order; ++vertex) {
+        points[next[cellOf(vertex)]++] = vertex;
+    }
+
+    const double squared_radius { radius * radius };
+
+    auto connect = [&](size_t u, size_t v) {
+        double dx { x[u] - x[v] };
+        double dy { y[u] - y[v] };
+
+        if (dx * dx + dy * dy <= squared_radius) {
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    };
+
+    // every pair of cells is visited once: the cell itself, then the right, upper-left, upper and upper-right ones.
+    constexpr int offsets[4][2] {{1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+
+    for (size_t row {0}; row < side; ++row) {
+        for (size_t column {0}; column < side; ++column) {
+            size_t cell { row * side + column };
+
+            for (size_t i {first[cell]}; i < first[cell + 1]; ++i) {
+                for (size_t j {i + 1}; j < first[cell + 1]; ++j) {
+                    connect(points[i], points[j]);
+                }
+            }
+
+            for (const auto& offset : offsets) {
+                long neighbor_column { static_cast<long>(column) + offset[0] };
+                long neighbor_row { static_cast<long>(row) + offset[1] };
+
+                if (neighbor_column < 0 || neighbor_column >= static_cast<long>(side) || 
+                        neighbor_row >= static_cast<long>(side)) {
+                    continue;
+                }
+
+                size_t neighbor_cell { static_cast<size_t>(neighbor_row) * side + static_cast<size_t>(neighbor_column) };
+
+                for (size_t i {first[cell]}; i < first[cell + 1]; ++i) {
+                    for (size_t j {first[neighbor_cell]}; j < first[neighbor_cell + 1]; ++j) {
+                        connect(points[i], points[j]);
+                    }
+                }
+            }
+        }
+    }
+
+    return CSRGraph(order, std::move(endpoints));
+}
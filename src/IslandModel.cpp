@@ -0,0 +1,174 @@
+#include "IslandModel.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Define de quais ilhas cada uma das `islands` ilhas recebe imigrantes: a anterior no anel (`ring`), todas as
+ * outras (`full`) ou uma outra sorteada a cada chamada (`random`), com `random_state`.
+ */
+
+void chooseMigrationSources(MigrationTopology topology, size_t islands, Xoshiro256& random_state,
+    std::vector<std::vector<size_t>>& sources) {
+
+    sources.assign(islands, {});
+
+    for (size_t i {0}; i < islands && islands > 1; ++i) {
+        if (topology == MigrationTopology::ring) {
+            sources[i].push_back((i + islands - 1) % islands);
+        }
+
+        else if (topology == MigrationTopology::full) {
+            for (size_t j {0}; j < islands; ++j) {
+                if (j != i) {
+                    sources[i].push_back(j);
+                }
+            }
+        }
+
+        else {
+            size_t source { static_cast<size_t>(random_state() % (islands - 1)) };
+            sources[i].push_back(source < i ? source : source + 1);
+        }
+    }
+}
+
+/**
+ * @brief Cria `islands` algoritmos genéticos sobre o mesmo grafo, cada um com `population_size` indivíduos.
+ *
+ * A ilha `i` usa a semente `mixSeed(seed, i)` e roda em uma única thread; as ilhas são distribuídas entre as
+ * `threads` threads do modelo. As migrações acontecem entre épocas de `migration_interval` gerações, quando nenhuma
+ * ilha está evoluindo: cada ilha escreve seus emigrantes apenas na própria caixa de saída e lê as das suas fontes
+ * depois que todas terminaram, então as caixas não precisam de trava e o resultado não depende do número de threads.
+ */
+
+IslandModel::IslandModel(const CSRGraph& graph, size_t islands, size_t population_size, size_t genes_size,
+    size_t generations, float elitism_rate, float crossover_rate, float mutation_rate, size_t tournament_population_size,
+    uint64_t seed, size_t migration_interval, size_t migrants, MigrationTopology topology, size_t threads)
+    : outboxes(islands), inboxes(islands), sources(islands), generations(generations),
+      migration_interval(std::max<size_t>(migration_interval, 1)), migrants(migrants), topology(topology),
+      random_state(mixSeed(seed, islands)), pool(std::min(threads, islands)) {
+
+    if (islands == 0) {
+        throw std::invalid_argument("IslandModel requires at least one island");
+    }
+
+    this->islands.reserve(islands);
+
+    for (size_t i {0}; i < islands; ++i) {
+        this->islands.push_back(std::make_unique<GeneticAlgorithm>(graph, population_size, genes_size, generations,
+            elitism_rate, crossover_rate, mutation_rate, tournament_population_size, mixSeed(seed, i)));
+    }
+}
+
+/**
+ * @brief Troca os melhores indivíduos entre as ilhas: as caixas de saída, preenchidas ao fim da época, são copiadas
+ * para as caixas de entrada das ilhas que as recebem, e os imigrantes substituem os piores indivíduos de cada ilha.
+ */
+
+void IslandModel::migrate() {
+    chooseMigrationSources(topology, islands.size(), random_state, sources);
+
+    pool.parallelFor(islands.size(), [&](size_t i) {
+        inboxes[i].clear();
+
+        for (size_t source : sources[i]) {
+            inboxes[i].insert(inboxes[i].end(), outboxes[source].begin(), outboxes[source].end());
+        }
+
+        islands[i]->replaceWorstIndividuals(inboxes[i]);
+    });
+}
+
+/**
+ * @brief Cria a população inicial de cada ilha e as evolui por `generations` gerações, em épocas separadas por
+ * migrações.
+ *
+ * A média e o desvio padrão retornados são os da união das populações das ilhas na última geração. Na diversidade
+ * inicial, o número de genomas distintos é a soma dos de cada ilha, e a distância de Hamming é a média das ilhas.
+ *
+ * @return Uma tupla com o melhor fitness, a média e o desvio padrão do fitness.
+ */
+
+std::tuple<size_t, float, float> IslandModel::run(std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics,
+    size_t chosen_heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
+
+    std::vector<std::tuple<size_t, float, float>> statistics(islands.size());
+
+    pool.parallelFor(islands.size(), [&](size_t i) {
+        islands[i]->initialize(heuristics, chosen_heuristic);
+    });
+
+    size_t generation {0};
+
+    while (generation < generations) {
+        size_t epoch { std::min(migration_interval, generations - generation) };
+        generation += epoch;
+
+        bool last_epoch { generation == generations };
+
+        pool.parallelFor(islands.size(), [&](size_t i) {
+            statistics[i] = islands[i]->evolve(epoch, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+
+            if (!last_epoch) {
+                islands[i]->getBestIndividuals(migrants, outboxes[i]);
+            }
+        });
+
+        if (!last_epoch) {
+            migrate();
+        }
+    }
+
+    size_t best_island {0};
+    float sum_squares {0};
+
+    fitness_mean = 0;
+    initial_diversity = {0, 0.0f};
+
+    for (size_t i {0}; i < islands.size(); ++i) {
+        // a melhor solução de uma ilha pode ter chegado por migração depois da sua última época.
+        if (islands[i]->getBestFitness() < islands[best_island]->getBestFitness()) {
+            best_island = i;
+        }
+
+        float mean { std::get<1>(statistics[i]) };
+        float std { std::get<2>(statistics[i]) };
+
+        fitness_mean += mean;
+        sum_squares += std * std + mean * mean;
+
+        PopulationDiversity diversity { islands[i]->getInitialDiversity() };
+        initial_diversity.distinct_genomes += diversity.distinct_genomes;
+        initial_diversity.mean_hamming_distance += diversity.mean_hamming_distance;
+    }
+
+    fitness_mean /= islands.size();
+    fitness_std = std::sqrt(std::max(0.0f, sum_squares / islands.size() - fitness_mean * fitness_mean));
+    initial_diversity.mean_hamming_distance /= islands.size();
+
+    best_solution = islands[best_island]->getBestSolution();
+    best_fitness = islands[best_island]->getBestFitness();
+
+    return {best_fitness, fitness_mean, fitness_std};
+}
+
+std::vector<Gene> IslandModel::getBestSolution() { return best_solution; }
+
+size_t IslandModel::getBestFitness() { return best_fitness; }
+
+float IslandModel::getFitnessMean() { return fitness_mean; }
+
+float IslandModel::getFitnessSTD() { return fitness_std; }
+
+PopulationDiversity IslandModel::getInitialDiversity() { return initial_diversity; }
+
+/**
+ * @brief Aplica a mesma busca local memética a todas as ilhas; o intervalo conta as gerações de cada ilha desde a
+ * população inicial, atravessando as épocas.
+ */
+
+void IslandModel::setLocalSearch(const LocalSearchSettings& settings) {
+    for (auto& island : islands) {
+        island->setLocalSearch(settings);
+    }
+}
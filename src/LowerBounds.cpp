@@ -0,0 +1,382 @@
+#include "LowerBounds.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+
+namespace {
+
+// passos de subgradiente por componente, no máximo `relaxation_iterations` e no máximo `relaxation_work` visitas a
+// vértices e arestas somadas; qualquer vetor de multiplicadores dá um limite válido, então parar antes só o deixa
+// mais fraco.
+constexpr size_t relaxation_iterations {500};
+constexpr size_t relaxation_work {500000000};
+
+// a busca para quando o limite melhora menos que essa fração em `convergence_window` passos.
+constexpr size_t convergence_window {50};
+constexpr double convergence_tolerance {1e-3};
+
+// componentes com mais vértices que isso dividem cada passo em blocos de `chunk_order` vértices, calculados em
+// paralelo; as menores são distribuídas inteiras entre as threads. O tamanho dos blocos não depende do número de
+// threads, então o limite também não.
+constexpr size_t chunk_order {4096};
+
+size_t roundUp(double value) { return static_cast<size_t>(std::max(0.0, std::ceil(value - 1e-6))); }
+
+// cobertura que o rótulo `label` de um vértice de grau `degree` pode dar somando a dele e a dos vizinhos, sem passar
+// das 3 unidades que cada um precisa.
+double coverage(size_t label, size_t degree) {
+    return static_cast<double>(std::min<size_t>(label, 3) + (label - 1) * degree);
+}
+
+/**
+ * @brief Limite da sequência de graus de uma componente: o valor da relaxação linear de "cobrir 3n unidades com no
+ * máximo um rótulo por vértice", em que o rótulo l de um vértice de grau d custa l e cobre `coverage(l, d)`.
+ *
+ * Pelo dual, o valor é o máximo em λ ≥ 0 de 3nλ - Σ_v max(0, max_l (λ coverage(l, d_v) - l)), uma função côncava e
+ * linear por partes de λ, então basta avaliá-la nos pontos de quebra. Os vértices são agrupados por grau.
+ */
+
+double degreeSequenceBound(const CSRGraph& graph, const std::vector<size_t>& vertices) {
+    std::map<size_t, size_t> degrees;
+
+    for (size_t vertex : vertices) {
+        ++degrees[graph.getVertexDegree(vertex)];
+    }
+
+    std::vector<double> breakpoints;
+
+    for (const auto& [degree, count] : degrees) {
+        for (size_t label {2}; label <= 4; ++label) {
+            breakpoints.push_back(label / coverage(label, degree));
+
+            for (size_t other {label + 1}; other <= 4; ++other) {
+                double gain { coverage(other, degree) - coverage(label, degree) };
+
+                if (gain > 0) {
+                    breakpoints.push_back((other - label) / gain);
+                }
+            }
+        }
+    }
+
+    const double demand { 3.0 * vertices.size() };
+    double best {0};
+
+    for (double lambda : breakpoints) {
+        double value { demand * lambda };
+
+        for (const auto& [degree, count] : degrees) {
+            double excess {0};
+
+            for (size_t label {2}; label <= 4; ++label) {
+                excess = std::max(excess, lambda * coverage(label, degree) - label);
+            }
+
+            value -= count * excess;
+        }
+
+        best = std::max(best, value);
+    }
+
+    return best;
+}
+
+// Relaxação lagrangiana das restrições de cobertura "f(v) + Σ_{u ∈ N(v), f(u) > 0} (f(u) - 1) ≥ 3", mantendo que cada
+// vértice recebe no máximo um rótulo: com multiplicadores y ≥ 0, cada vértice fica com o rótulo de menor custo
+// reduzido, se ele for negativo. O valor é um limite inferior para quaisquer y, e o seu máximo é o da relaxação
+// linear. As componentes não compartilham vértices, então podem usar os mesmos vetores ao mesmo tempo.
+//
+// Antes, como no `ExactSolver`, um vértice com pelo menos duas folhas vizinhas recebe 4 e suas folhas recebem 0, o
+// que alguma FDRT ótima faz; sem isso, a relaxação espalha frações pelas folhas e fica bem abaixo do ótimo em árvores.
+
+class Relaxation {
+private:
+    const CSRGraph& graph;
+
+    std::vector<double> multipliers;
+    std::vector<double> subgradient;
+    std::vector<uint8_t> labels;
+    std::vector<uint8_t> state;
+
+    enum : uint8_t { deficient, covered, fixed };
+
+    template <typename Task>
+    static double sumChunks(ThreadPool* pool, size_t count, const Task& task);
+
+    double reduce(const std::vector<size_t>& vertices);
+    double lagrangian(const std::vector<size_t>& vertices, ThreadPool* pool, double& norm);
+
+public:
+    explicit Relaxation(const CSRGraph& graph)
+        : graph(graph), multipliers(graph.getOrder(), 0), subgradient(graph.getOrder(), 0),
+          labels(graph.getOrder(), 0), state(graph.getOrder(), deficient) {}
+
+    double solve(const std::vector<size_t>& vertices, ThreadPool* pool, std::vector<double>& best_multipliers);
+};
+
+/**
+ * @brief Soma `task(begin, end)` sobre os blocos de `chunk_order` posições de [0, count), em paralelo quando `pool`
+ * não é nulo. As parcelas são somadas na ordem dos blocos, então o resultado é o mesmo com qualquer número de threads.
+ */
+
+template <typename Task>
+double Relaxation::sumChunks(ThreadPool* pool, size_t count, const Task& task) {
+    const size_t chunks { (count + chunk_order - 1) / chunk_order };
+
+    if (!pool || chunks <= 1) {
+        return task(0, count);
+    }
+
+    std::vector<double> partial(chunks);
+
+    pool->parallelFor(chunks, [&](size_t chunk) {
+        partial[chunk] = task(chunk * chunk_order, std::min(count, (chunk + 1) * chunk_order));
+    });
+
+    double sum {0};
+
+    for (double value : partial) {
+        sum += value;
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Aplica a redução das folhas: os vértices fixados ficam fora da relaxação, e os que eles já cobrem deixam de
+ * ter restrição, com multiplicador 0.
+ *
+ * @return O peso dos rótulos fixados.
+ */
+
+double Relaxation::reduce(const std::vector<size_t>& vertices) {
+    double weight {0};
+
+    for (size_t vertex : vertices) {
+        state[vertex] = deficient;
+    }
+
+    for (size_t vertex : vertices) {
+        size_t leaves {0};
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            leaves += graph.getVertexDegree(neighbor) == 1;
+        }
+
+        if (leaves < 2) {
+            continue;
+        }
+
+        weight += 4;
+        state[vertex] = fixed;
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            if (graph.getVertexDegree(neighbor) == 1) {
+                state[neighbor] = fixed;
+            }
+
+            else if (state[neighbor] == deficient) {
+                state[neighbor] = covered;
+            }
+        }
+    }
+
+    return weight;
+}
+
+/**
+ * @brief Valor da relaxação com os multiplicadores atuais. Uma passada escolhe o rótulo de cada vértice e outra
+ * calcula o subgradiente, 3 menos a cobertura que a solução relaxada dá a cada vértice; as duas só leem dados dos
+ * vizinhos, então cada bloco pode ser calculado por uma thread. `norm` recebe o quadrado da norma do subgradiente.
+ */
+
+double Relaxation::lagrangian(const std::vector<size_t>& vertices, ThreadPool* pool, double& norm) {
+    double value { sumChunks(pool, vertices.size(), [&](size_t begin, size_t end) {
+        double sum {0};
+
+        for (size_t i {begin}; i < end; ++i) {
+            const size_t vertex { vertices[i] };
+            double neighbors {0};
+
+            for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+                neighbors += multipliers[neighbor];
+            }
+
+            double reduced {0};
+            labels[vertex] = 0;
+
+            if (state[vertex] == fixed) {
+                continue;
+            }
+
+            for (size_t label {2}; label <= 4; ++label) {
+                double cost { label - std::min<size_t>(label, 3) * multipliers[vertex] - (label - 1.0) * neighbors };
+
+                if (cost < reduced) {
+                    labels[vertex] = static_cast<uint8_t>(label);
+                    reduced = cost;
+                }
+            }
+
+            sum += 3 * multipliers[vertex] + reduced;
+        }
+
+        return sum;
+    }) };
+
+    norm = sumChunks(pool, vertices.size(), [&](size_t begin, size_t end) {
+        double sum {0};
+
+        for (size_t i {begin}; i < end; ++i) {
+            const size_t vertex { vertices[i] };
+            double received { static_cast<double>(std::min<uint8_t>(labels[vertex], 3)) };
+
+            for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+                received += labels[neighbor] > 0 ? labels[neighbor] - 1.0 : 0.0;
+            }
+
+            subgradient[vertex] = state[vertex] == deficient ? 3 - received : 0;
+            sum += subgradient[vertex] * subgradient[vertex];
+        }
+
+        return sum;
+    });
+
+    return value;
+}
+
+/**
+ * @brief Limite da relaxação para uma componente, depois da redução das folhas. Os multiplicadores partem de y_v = min_{u ∈ N[v]} 4 / (3 (d(u) + 1)),
+ * que num grafo regular já dá 4n / (Δ + 1), e seguem passos de subgradiente com o passo de Polyak, mirando 20% acima
+ * do melhor valor encontrado; o passo cai pela metade a cada 20 passos sem melhora. Os multiplicadores do melhor
+ * valor ficam em `best_multipliers`, nas posições dos vértices da componente.
+ */
+
+double Relaxation::solve(const std::vector<size_t>& vertices, ThreadPool* pool, std::vector<double>& best_multipliers) {
+    const double reduced_weight { reduce(vertices) };
+
+    for (size_t vertex : vertices) {
+        multipliers[vertex] = 4.0 / (3.0 * (graph.getVertexDegree(vertex) + 1));
+
+        if (state[vertex] != deficient) {
+            multipliers[vertex] = 0;
+            continue;
+        }
+
+        for (size_t neighbor : graph.getAdjacencyList(vertex)) {
+            multipliers[vertex] = std::min(multipliers[vertex], 4.0 / (3.0 * (graph.getVertexDegree(neighbor) + 1)));
+        }
+    }
+
+    double norm {0};
+    double value { lagrangian(vertices, pool, norm) };
+    double best { value };
+
+    for (size_t vertex : vertices) {
+        best_multipliers[vertex] = multipliers[vertex];
+    }
+    double window_start { value };
+    double scale {2};
+    size_t failures {0};
+
+    size_t size {0};
+
+    for (size_t vertex : vertices) {
+        size += 1 + graph.getVertexDegree(vertex);
+    }
+
+    const size_t iterations { std::clamp<size_t>(relaxation_work / size, convergence_window, relaxation_iterations) };
+
+    for (size_t iteration {1}; iteration <= iterations && norm > 1e-12; ++iteration) {
+        const double target { std::max(best + 1, 1.2 * best) };
+        const double step { scale * (target - value) / norm };
+
+        for (size_t vertex : vertices) {
+            multipliers[vertex] = std::max(0.0, multipliers[vertex] + step * subgradient[vertex]);
+        }
+
+        // o subgradiente é do ponto avaliado, então os melhores multiplicadores são copiados antes do próximo passo.
+        value = lagrangian(vertices, pool, norm);
+
+        if (value > best) {
+            best = value;
+            failures = 0;
+
+            for (size_t vertex : vertices) {
+                best_multipliers[vertex] = multipliers[vertex];
+            }
+        }
+
+        else if (++failures % 20 == 0) {
+            scale /= 2;
+        }
+
+        if (iteration % convergence_window == 0) {
+            if (best - window_start < convergence_tolerance * best) {
+                break;
+            }
+
+            window_start = best;
+        }
+    }
+
+    return reduced_weight + best;
+}
+
+} // namespace
+
+/**
+ * @brief Calcula os limites de cada componente conexa com até `threads` threads. Uma componente com um vértice
+ * precisa de peso 3 e uma com dois, de peso 4, os dois valores exatos; os seus multiplicadores ficam em 0.
+ */
+
+LowerBounds::LowerBounds(const CSRGraph& graph, size_t threads) {
+    const auto components { graph.components(threads) };
+    std::vector<size_t> degree_sequence(components.size());
+    std::vector<size_t> relaxation(components.size());
+    std::vector<size_t> large;
+    Relaxation solver(graph);
+
+    multipliers.assign(graph.getOrder(), 0);
+
+    ThreadPool pool(std::max<size_t>(threads, 1));
+
+    auto computeBounds = [&](size_t index, ThreadPool* inner) {
+        const auto& vertices { components[index] };
+
+        if (vertices.size() <= 2) {
+            degree_sequence[index] = relaxation[index] = vertices.size() == 1 ? 3 : 4;
+            return;
+        }
+
+        degree_sequence[index] = roundUp(degreeSequenceBound(graph, vertices));
+        relaxation[index] = roundUp(solver.solve(vertices, inner, multipliers));
+    };
+
+    for (size_t index {0}; index < components.size(); ++index) {
+        if (components[index].size() > chunk_order) {
+            large.push_back(index);
+        }
+    }
+
+    pool.parallelFor(components.size(), [&](size_t index) {
+        if (components[index].size() <= chunk_order) {
+            computeBounds(index, nullptr);
+        }
+    });
+
+    for (size_t index : large) {
+        computeBounds(index, &pool);
+    }
+
+    component_bounds.resize(components.size());
+
+    for (size_t index {0}; index < components.size(); ++index) {
+        degree_sequence_bound += degree_sequence[index];
+        relaxation_bound += relaxation[index];
+        component_bounds[index] = std::max(degree_sequence[index], relaxation[index]);
+        bound += component_bounds[index];
+    }
+}
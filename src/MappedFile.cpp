@@ -0,0 +1,49 @@
+#include "MappedFile.hpp"
+
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Maps `filename` read-only. The pages are loaded on demand and shared with the page cache, so mapping a
+ * file that was read recently costs no I/O. Empty files are not mapped and have a null `data()`.
+ */
+
+MappedFile::MappedFile(const std::string& filename): bytes(nullptr), length(0) {
+    int descriptor { open(filename.c_str(), O_RDONLY) };
+
+    if (descriptor < 0) {
+        throw std::runtime_error("Error opening the file!");
+    }
+
+    struct stat status;
+
+    if (fstat(descriptor, &status) != 0) {
+        close(descriptor);
+        throw std::runtime_error("Error opening the file!");
+    }
+
+    length = static_cast<size_t>(status.st_size);
+
+    if (length > 0) {
+        void* address { mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0) };
+
+        if (address == MAP_FAILED) {
+            close(descriptor);
+            throw std::runtime_error("Error mapping the file!");
+        }
+
+        madvise(address, length, MADV_SEQUENTIAL);
+        bytes = static_cast<const char*>(address);
+    }
+
+    close(descriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (bytes != nullptr) {
+        munmap(const_cast<char*>(bytes), length);
+    }
+}
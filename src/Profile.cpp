@@ -0,0 +1,84 @@
+#include "Profile.hpp"
+
+namespace {
+
+thread_local ProfileSnapshot* current_buffer {nullptr};
+
+} // namespace
+
+const char* phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::seeding: return "seeding";
+        case Phase::selection: return "selection";
+        case Phase::crossover: return "crossover";
+        case Phase::copy: return "copy";
+        case Phase::mutation: return "mutation";
+        case Phase::repair: return "repair";
+        case Phase::local_search: return "local_search";
+        case Phase::elitism: return "elitism";
+        default: return "statistics";
+    }
+}
+
+const char* counterName(Counter counter) {
+    switch (counter) {
+        case Counter::repair_calls: return "repair_calls";
+        case Counter::repaired_labels: return "repaired_labels";
+        default: return "feasible_calls";
+    }
+}
+
+void Profile::add(const ProfileSnapshot& snapshot) {
+    for (size_t i {0}; i < phase_count; ++i) {
+        nanoseconds[i].fetch_add(snapshot.nanoseconds[i], std::memory_order_relaxed);
+        calls[i].fetch_add(snapshot.calls[i], std::memory_order_relaxed);
+    }
+
+    for (size_t i {0}; i < counter_count; ++i) {
+        counters[i].fetch_add(snapshot.counters[i], std::memory_order_relaxed);
+    }
+}
+
+ProfileSnapshot Profile::snapshot() const {
+    ProfileSnapshot snapshot;
+
+    for (size_t i {0}; i < phase_count; ++i) {
+        snapshot.nanoseconds[i] = nanoseconds[i].load(std::memory_order_relaxed);
+        snapshot.calls[i] = calls[i].load(std::memory_order_relaxed);
+    }
+
+    for (size_t i {0}; i < counter_count; ++i) {
+        snapshot.counters[i] = counters[i].load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void Profile::reset() {
+    for (size_t i {0}; i < phase_count; ++i) {
+        nanoseconds[i].store(0, std::memory_order_relaxed);
+        calls[i].store(0, std::memory_order_relaxed);
+    }
+
+    for (size_t i {0}; i < counter_count; ++i) {
+        counters[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ProfileScope::ProfileScope(Profile& profile) : profile(profile), previous(current_buffer) { current_buffer = &buffer; }
+
+ProfileScope::~ProfileScope() {
+    profile.add(buffer);
+    current_buffer = previous;
+}
+
+ProfileSnapshot* ProfileScope::current() { return current_buffer; }
+
+PhaseTimer::~PhaseTimer() {
+    if (ProfileSnapshot* buffer { ProfileScope::current() }) {
+        auto elapsed { std::chrono::steady_clock::now() - start };
+        buffer->nanoseconds[static_cast<size_t>(phase)] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        ++buffer->calls[static_cast<size_t>(phase)];
+    }
+}
@@ -0,0 +1,53 @@
+#include "ResidualGraph.hpp"
+
+/**
+ * @brief Starts with every vertex of `graph` alive. Vertices that are already isolated are queued for
+ * `deleteIsolatedVertices`.
+ */
+
+ResidualGraph::ResidualGraph(const CSRGraph& graph):
+    graph(graph), alive(graph.getOrder(), 1), degree(graph.getOrder()), vertices(graph.getOrder()), 
+    position(graph.getOrder()) {
+
+    for (size_t vertex {0}; vertex < graph.getOrder(); ++vertex) {
+        degree[vertex] = graph.getVertexDegree(vertex);
+        vertices[vertex] = vertex;
+        position[vertex] = vertex;
+
+        if (degree[vertex] == 0) {
+            isolated.push_back(vertex);
+        }
+    }
+}
+
+/**
+ * @brief Deletes `vertex` in O(degree). The alive list is kept dense by moving its last element into the freed
+ * slot, and neighbors whose degree drops to zero are queued as isolated.
+ */
+
+void ResidualGraph::deleteVertex(size_t vertex) {
+    if (!alive[vertex]) { return; }
+
+    alive[vertex] = 0;
+
+    size_t last { vertices.back() };
+    vertices[position[vertex]] = last;
+    position[last] = position[vertex];
+    vertices.pop_back();
+
+    for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+        if (alive[neighbor] && --degree[neighbor] == 0) {
+            isolated.push_back(neighbor);
+        }
+    }
+}
+
+/**
+ * @brief Deletes every alive neighbor of `vertex`, keeping `vertex` itself.
+ */
+
+void ResidualGraph::deleteAdjacencyList(size_t vertex) {
+    for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+        deleteVertex(neighbor);
+    }
+}
@@ -0,0 +1,123 @@
+#include "ThreadPool.hpp"
+
+/**
+ * @brief Creates a pool that runs jobs on `threads` threads, the calling thread included.
+ *
+ * With `threads <= 1` no worker is started and `parallelFor` runs every task inline, in index order.
+ */
+
+ThreadPool::ThreadPool(size_t threads):
+    invoke(nullptr), task(nullptr), task_count(0), next_index(0), busy_workers(0), job_id(0), stopping(false) {
+
+    for (size_t i {1}; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    job_available.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::getThreadCount() const { return workers.size() + 1; }
+
+size_t ThreadPool::defaultThreadCount() {
+    size_t threads { std::thread::hardware_concurrency() };
+    return threads > 0 ? threads : 1;
+}
+
+void ThreadPool::runTasks() {
+    size_t index {0};
+
+    while ((index = next_index.fetch_add(1, std::memory_order_relaxed)) < task_count) {
+        try {
+            invoke(task, index);
+        }
+
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    size_t last_job {0};
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_available.wait(lock, [&] { return stopping || job_id != last_job; });
+
+            if (stopping) { return; }
+
+            last_job = job_id;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (--busy_workers == 0) {
+                job_finished.notify_one();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs `task(i)` for every `i` in `[0, count)` and blocks until all of them have finished.
+ *
+ * Indices are handed out dynamically, so tasks must not depend on which thread runs them. The first exception
+ * thrown by a task is rethrown here once the job is complete. Calls must not be nested on the same pool.
+ */
+
+void ThreadPool::run(size_t count, void (*invoke)(const void*, size_t), const void* task) {
+    if (workers.empty() || count <= 1) {
+        for (size_t i {0}; i < count; ++i) {
+            invoke(task, i);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->invoke = invoke;
+        this->task = task;
+        this->task_count = count;
+        this->next_index.store(0, std::memory_order_relaxed);
+        this->busy_workers = workers.size();
+        this->error = nullptr;
+        ++this->job_id;
+    }
+
+    job_available.notify_all();
+
+    runTasks();
+
+    std::exception_ptr job_error;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        job_finished.wait(lock, [&] { return busy_workers == 0; });
+        this->task = nullptr;
+        job_error = this->error;
+    }
+
+    if (job_error) {
+        std::rethrow_exception(job_error);
+    }
+}
@@ -0,0 +1,414 @@
+#include "Transport.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef TRD_WITH_MPI
+#include <mpi.h>
+#endif
+
+namespace {
+
+struct SocketAddress {
+    sockaddr_storage storage;
+    socklen_t length;
+    bool is_unix;
+    std::string path;
+};
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+    throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+// address on which rank `peer` listens.
+SocketAddress resolveAddress(const std::string& address, size_t peer) {
+    SocketAddress result {};
+
+    if (address.rfind("unix:", 0) == 0) {
+        result.is_unix = true;
+        result.path = address.substr(5) + '.' + std::to_string(peer);
+
+        sockaddr_un* local { reinterpret_cast<sockaddr_un*>(&result.storage) };
+
+        if (result.path.size() >= sizeof(local->sun_path)) {
+            throw std::invalid_argument("Socket path too long: " + result.path);
+        }
+
+        local->sun_family = AF_UNIX;
+        std::memcpy(local->sun_path, result.path.c_str(), result.path.size() + 1);
+        result.length = sizeof(sockaddr_un);
+
+        return result;
+    }
+
+    if (address.rfind("tcp:", 0) == 0) {
+        size_t colon { address.rfind(':') };
+
+        if (colon <= 4) {
+            throw std::invalid_argument("Invalid transport address: " + address);
+        }
+
+        std::string host { address.substr(4, colon - 4) };
+        std::string port { std::to_string(std::stoul(address.substr(colon + 1)) + peer) };
+
+        addrinfo hints {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo* found { nullptr };
+
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &found) != 0 || found == nullptr) {
+            throw std::invalid_argument("Cannot resolve host: " + host);
+        }
+
+        std::memcpy(&result.storage, found->ai_addr, found->ai_addrlen);
+        result.length = found->ai_addrlen;
+        freeaddrinfo(found);
+
+        return result;
+    }
+
+    throw std::invalid_argument("Invalid transport address: " + address);
+}
+
+void writeAll(int descriptor, const void* data, size_t length) {
+    const uint8_t* bytes { static_cast<const uint8_t*>(data) };
+
+    while (length > 0) {
+        ssize_t written { send(descriptor, bytes, length, MSG_NOSIGNAL) };
+
+        if (written < 0) {
+            if (errno == EINTR) { continue; }
+            throwSystemError("Error writing to socket");
+        }
+
+        bytes += written;
+        length -= static_cast<size_t>(written);
+    }
+}
+
+void readAll(int descriptor, void* data, size_t length) {
+    uint8_t* bytes { static_cast<uint8_t*>(data) };
+
+    while (length > 0) {
+        ssize_t read { recv(descriptor, bytes, length, 0) };
+
+        if (read == 0) {
+            throw std::runtime_error("Connection closed by peer");
+        }
+
+        if (read < 0) {
+            if (errno == EINTR) { continue; }
+            throwSystemError("Error reading from socket");
+        }
+
+        bytes += read;
+        length -= static_cast<size_t>(read);
+    }
+}
+
+// progress of one message through a socket: an 8-byte length header followed by the payload.
+struct Transfer {
+    int descriptor;
+    uint64_t header;
+    size_t offset;
+    const uint8_t* outgoing;
+    std::vector<uint8_t>* incoming;
+
+    size_t total() const { return sizeof(header) + (outgoing != nullptr ? header : incoming->size()); }
+    bool done() const { return offset >= sizeof(header) && offset == total(); }
+};
+
+} // namespace
+
+int SocketTransport::listen(const std::string& address) {
+    SocketAddress local { resolveAddress(address, rank) };
+    int descriptor { socket(local.storage.ss_family, SOCK_STREAM, 0) };
+
+    if (descriptor < 0) {
+        throwSystemError("Error creating socket");
+    }
+
+    if (local.is_unix) {
+        unlink(local.path.c_str());
+        socket_path = local.path;
+    }
+
+    else {
+        int enable {1};
+        setsockopt(descriptor, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    }
+
+    if (bind(descriptor, reinterpret_cast<sockaddr*>(&local.storage), local.length) != 0 ||
+            ::listen(descriptor, static_cast<int>(size)) != 0) {
+        close(descriptor);
+        throwSystemError("Error listening on " + address);
+    }
+
+    return descriptor;
+}
+
+// connects to rank `peer`, retrying for up to a minute while it is not listening yet, and introduces this rank.
+
+int SocketTransport::connect(const std::string& address, size_t peer) {
+    SocketAddress remote { resolveAddress(address, peer) };
+    auto deadline { std::chrono::steady_clock::now() + std::chrono::minutes(1) };
+
+    while (true) {
+        int descriptor { socket(remote.storage.ss_family, SOCK_STREAM, 0) };
+
+        if (descriptor < 0) {
+            throwSystemError("Error creating socket");
+        }
+
+        if (::connect(descriptor, reinterpret_cast<sockaddr*>(&remote.storage), remote.length) == 0) {
+            uint64_t introduction { rank };
+            writeAll(descriptor, &introduction, sizeof(introduction));
+            return descriptor;
+        }
+
+        int error { errno };
+        close(descriptor);
+
+        if ((error != ECONNREFUSED && error != ENOENT) || std::chrono::steady_clock::now() > deadline) {
+            errno = error;
+            throwSystemError("Error connecting to rank " + std::to_string(peer));
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
+
+/**
+ * @brief Connects this rank to every other one. Rank r listens first, then connects to the ranks below it and
+ * accepts the connections of the ranks above it, so the mesh is built without ordering the process startup.
+ */
+
+SocketTransport::SocketTransport(const std::string& address, size_t rank, size_t size):
+    rank(rank), size(size), peers(size, -1) {
+
+    if (rank >= size) {
+        throw std::invalid_argument("Rank " + std::to_string(rank) + " out of range");
+    }
+
+    int listener { listen(address) };
+
+    try {
+        for (size_t peer {0}; peer < rank; ++peer) {
+            peers[peer] = connect(address, peer);
+        }
+
+        for (size_t accepted {rank + 1}; accepted < size; ++accepted) {
+            int descriptor { accept(listener, nullptr, nullptr) };
+
+            if (descriptor < 0) {
+                throwSystemError("Error accepting connection");
+            }
+
+            uint64_t peer {0};
+            readAll(descriptor, &peer, sizeof(peer));
+
+            if (peer >= size || peers[peer] != -1) {
+                close(descriptor);
+                throw std::runtime_error("Unexpected connection from rank " + std::to_string(peer));
+            }
+
+            peers[peer] = descriptor;
+        }
+    }
+
+    catch (...) {
+        close(listener);
+        closeAll();
+        throw;
+    }
+
+    close(listener);
+
+    for (size_t peer {0}; peer < size; ++peer) {
+        if (peers[peer] < 0) { continue; }
+
+        if (socket_path.empty()) {
+            int enable {1};
+            setsockopt(peers[peer], IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+
+        fcntl(peers[peer], F_SETFL, fcntl(peers[peer], F_GETFL) | O_NONBLOCK);
+    }
+}
+
+SocketTransport::~SocketTransport() {
+    closeAll();
+}
+
+void SocketTransport::closeAll() {
+    for (int& descriptor : peers) {
+        if (descriptor >= 0) {
+            close(descriptor);
+            descriptor = -1;
+        }
+    }
+
+    if (!socket_path.empty()) {
+        unlink(socket_path.c_str());
+        socket_path.clear();
+    }
+}
+
+/**
+ * @brief Sends and receives every message at once with `poll`, writing and reading whatever each socket accepts, so
+ * no rank blocks on a full socket buffer while its peer is also sending.
+ */
+
+void SocketTransport::exchange(const std::vector<size_t>& destinations, const std::vector<uint8_t>& message,
+    const std::vector<size_t>& sources, std::vector<std::vector<uint8_t>>& messages) {
+
+    messages.resize(sources.size());
+
+    std::vector<Transfer> transfers;
+    transfers.reserve(destinations.size() + sources.size());
+
+    for (size_t destination : destinations) {
+        transfers.push_back({peers.at(destination), message.size(), 0, message.data(), nullptr});
+    }
+
+    for (size_t i {0}; i < sources.size(); ++i) {
+        messages[i].clear();
+        transfers.push_back({peers.at(sources[i]), 0, 0, nullptr, &messages[i]});
+    }
+
+    std::vector<pollfd> descriptors;
+    std::vector<size_t> pending;
+
+    while (true) {
+        descriptors.clear();
+        pending.clear();
+
+        for (size_t i {0}; i < transfers.size(); ++i) {
+            if (!transfers[i].done()) {
+                short events { static_cast<short>(transfers[i].outgoing != nullptr ? POLLOUT : POLLIN) };
+                descriptors.push_back({transfers[i].descriptor, events, 0});
+                pending.push_back(i);
+            }
+        }
+
+        if (pending.empty()) {
+            return;
+        }
+
+        if (poll(descriptors.data(), descriptors.size(), -1) < 0) {
+            if (errno == EINTR) { continue; }
+            throwSystemError("Error polling sockets");
+        }
+
+        for (size_t i {0}; i < pending.size(); ++i) {
+            if (descriptors[i].revents == 0) { continue; }
+
+            Transfer& transfer { transfers[pending[i]] };
+            uint8_t* header { reinterpret_cast<uint8_t*>(&transfer.header) };
+            ssize_t moved {0};
+
+            if (transfer.outgoing != nullptr) {
+                moved = transfer.offset < sizeof(transfer.header) ?
+                    send(transfer.descriptor, header + transfer.offset, sizeof(transfer.header) - transfer.offset, MSG_NOSIGNAL) :
+                    send(transfer.descriptor, transfer.outgoing + (transfer.offset - sizeof(transfer.header)),
+                        transfer.total() - transfer.offset, MSG_NOSIGNAL);
+            }
+
+            else {
+                moved = transfer.offset < sizeof(transfer.header) ?
+                    recv(transfer.descriptor, header + transfer.offset, sizeof(transfer.header) - transfer.offset, 0) :
+                    recv(transfer.descriptor, transfer.incoming->data() + (transfer.offset - sizeof(transfer.header)),
+                        transfer.total() - transfer.offset, 0);
+
+                if (moved == 0) {
+                    throw std::runtime_error("Connection closed by peer");
+                }
+            }
+
+            if (moved < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) { continue; }
+                throwSystemError("Error exchanging messages");
+            }
+
+            transfer.offset += static_cast<size_t>(moved);
+
+            // the payload of an incoming message is sized once its header is complete.
+            if (transfer.outgoing == nullptr && transfer.offset == sizeof(transfer.header)) {
+                transfer.incoming->resize(transfer.header);
+            }
+        }
+    }
+}
+
+#ifdef TRD_WITH_MPI
+
+MpiTransport::MpiTransport() {
+    int initialized {0};
+    MPI_Initialized(&initialized);
+
+    if (!initialized) {
+        MPI_Init(nullptr, nullptr);
+    }
+
+    int value {0};
+    MPI_Comm_rank(MPI_COMM_WORLD, &value);
+    rank = static_cast<size_t>(value);
+    MPI_Comm_size(MPI_COMM_WORLD, &value);
+    size = static_cast<size_t>(value);
+}
+
+MpiTransport::~MpiTransport() {
+    MPI_Finalize();
+}
+
+void MpiTransport::exchange(const std::vector<size_t>& destinations, const std::vector<uint8_t>& message,
+    const std::vector<size_t>& sources, std::vector<std::vector<uint8_t>>& messages) {
+
+    std::vector<MPI_Request> requests(destinations.size());
+
+    for (size_t i {0}; i < destinations.size(); ++i) {
+        MPI_Isend(message.data(), static_cast<int>(message.size()), MPI_BYTE, static_cast<int>(destinations[i]), 0,
+            MPI_COMM_WORLD, &requests[i]);
+    }
+
+    messages.resize(sources.size());
+
+    for (size_t i {0}; i < sources.size(); ++i) {
+        MPI_Status status;
+        int count {0};
+
+        MPI_Probe(static_cast<int>(sources[i]), 0, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_BYTE, &count);
+
+        messages[i].resize(static_cast<size_t>(count));
+        MPI_Recv(messages[i].data(), count, MPI_BYTE, static_cast<int>(sources[i]), 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+#endif
+
+std::unique_ptr<Transport> createTransport(const std::string& address, size_t rank, size_t size) {
+    if (address == "mpi") {
+#ifdef TRD_WITH_MPI
+        return std::make_unique<MpiTransport>();
+#else
+        throw std::invalid_argument("MPI transport not available: build with `make MPI=1`");
+#endif
+    }
+
+    return std::make_unique<SocketTransport>(address, rank, size);
+}
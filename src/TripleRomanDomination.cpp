@@ -22,15 +22,8 @@
  */
  
 void TripleRomanDomination::runGeneticAlgorithm(short int heuristic, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {  
-    std::vector<std::function<Chromosome(const Graph&)>> heuristics;
-    heuristics.reserve(3);
-    
-    heuristics.emplace_back(heuristic1);
-    heuristics.emplace_back(heuristic2);
-    heuristics.emplace_back(heuristic3);
+    std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics { getHeuristics() };
 
-   	genetic_algorithm.run(genetic_algorithm.getGenerations(), heuristics, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
-    
     std::tie(this->genetic_algorithm_best_fitness, 
      	this->genetic_algorithm_fitness_mean, 
      	this->genetic_algorithm_fitness_std) = genetic_algorithm.run(
@@ -42,8 +35,39 @@ void TripleRomanDomination::runGeneticAlgorithm(short int heuristic, bool flag_e
      		flag_crossover,
      		flag_mutation);
 
-this->solution_genetic_algorithm = genetic_algorithm.getBestSolution();
+    this->solution_genetic_algorithm = genetic_algorithm.getBestSolution();
+}
+
+// heurísticas de construção da população inicial, na ordem em que são escolhidas pelo parâmetro `heuristic` (1 a 3).
 
+std::vector<std::function<Chromosome(const CSRGraph&)>> TripleRomanDomination::getHeuristics() {
+    std::vector<std::function<Chromosome(const CSRGraph&)>> heuristics;
+    heuristics.reserve(3);
+    
+    heuristics.emplace_back(heuristic1);
+    heuristics.emplace_back(heuristic2);
+    heuristics.emplace_back(heuristic3);
+    
+    return heuristics;
+}
+
+/**
+ * @brief Continua a execução do algoritmo genético por mais `generations` gerações, a partir da população atual.
+ *
+ * Não repete a criação da população inicial pelas heurísticas; deve ser chamada após `runGeneticAlgorithm`.
+ */
+
+void TripleRomanDomination::continueGeneticAlgorithm(size_t generations, bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
+    std::tie(this->genetic_algorithm_best_fitness, 
+     	this->genetic_algorithm_fitness_mean, 
+     	this->genetic_algorithm_fitness_std) = genetic_algorithm.evolve(
+     		generations,
+     		flag_elitism,
+     		flag_selection,
+     		flag_crossover,
+     		flag_mutation);
+
+    this->solution_genetic_algorithm = genetic_algorithm.getBestSolution();
 }
 
 /**
@@ -58,20 +82,13 @@ this->solution_genetic_algorithm = genetic_algorithm.getBestSolution();
  * @return Chromosome Objeto que representa a solução de cromossomo gerada.
  */
  
-Chromosome TripleRomanDomination::heuristic1(const Graph& graph) {
-    Chromosome solution(Chromosome(graph.getOrder()));
-    std::vector<int> valid_vertices;
+Chromosome TripleRomanDomination::heuristic1(const CSRGraph& graph) {
+    Chromosome solution(graph.getOrder());
+    ResidualGraph temp {graph};
     size_t chosen_vertex {0};
-    valid_vertices.reserve(graph.getOrder());
-    Graph temp {graph};
 
     while (temp.getOrder() > 0) {
-        valid_vertices.clear();
-        for (const auto& pair : temp.getAdjacencyList()) {
-            valid_vertices.push_back(pair.first);
-        }
-        
-        chosen_vertex = valid_vertices[getRandomInt(0, valid_vertices.size() - 1)];
+        chosen_vertex = temp.getVertex(getRandomInt(0, temp.getOrder() - 1));
 
         if (temp.getVertexDegree(chosen_vertex) == 0) {
             solution.genes[chosen_vertex] = 3;
@@ -80,8 +97,8 @@ Chromosome TripleRomanDomination::heuristic1(const Graph& graph) {
         else {
             solution.genes[chosen_vertex] = 2;
             
-            for (const auto& neighbor : temp.getAdjacencyList(chosen_vertex)) {
-                if (solution.genes[neighbor] == -1) {
+            for (const auto& neighbor : graph.getAdjacencyList(chosen_vertex)) {
+                if (temp.vertexExists(neighbor)) {
                     solution.genes[neighbor] = 0;
                 }
             }
@@ -90,20 +107,7 @@ Chromosome TripleRomanDomination::heuristic1(const Graph& graph) {
         temp.deleteAdjacencyList(chosen_vertex);
         temp.deleteVertex(chosen_vertex);
 
-        std::vector<size_t> vertices_to_remove;
-        
-        vertices_to_remove.reserve(temp.getOrder());
-        
-        for (const auto& [i, _]: temp.getAdjacencyList()) {
-            if (temp.getVertexDegree(i) == 0) {
-                solution.genes[i] = 3;
-                vertices_to_remove.push_back(i);
-            }
-        }
-
-        for (const auto& vertex : vertices_to_remove) {
-            temp.deleteVertex(vertex);
-        }
+        temp.deleteIsolatedVertices([&](size_t vertex) { solution.genes[vertex] = 3; });
     }
 
     feasibilityCheck(graph, solution);
@@ -116,7 +120,7 @@ Chromosome TripleRomanDomination::heuristic1(const Graph& graph) {
 /**
  * @brief Segunda função heurística para gerar uma solução inicial de cromossomo para o problema de Dominação Romana Tripla.
  * 
- * Esta heurística utiliza um grafo auxiliar G', clone do grafo original, que terá seus vértices removidos durante as iterações. 
+ * Esta heurística utiliza um grafo residual G', que terá seus vértices removidos durante as iterações. 
  * Seleciona vértices aleatoriamente e atribui a eles o rótulo 4 (ou 3, caso o vértice seja isolado), e rótulo 0 aos seus vizinhos, 
  * removendo-os de G'. Após a remoção, se houver vértices isolados, eles são rotulados com 3.
  * 
@@ -124,23 +128,13 @@ Chromosome TripleRomanDomination::heuristic1(const Graph& graph) {
  * @return Chromosome Objeto que representa a solução de cromossomo gerada.
  */
  
-Chromosome TripleRomanDomination::heuristic2(const Graph& graph) {
-    Chromosome solution(Chromosome(graph.getOrder()));
-    std::vector<size_t> valid_vertices;
-
+Chromosome TripleRomanDomination::heuristic2(const CSRGraph& graph) {
+    Chromosome solution(graph.getOrder());
+    ResidualGraph temp {graph};
     size_t chosen_vertex {0};
-    
-    valid_vertices.reserve(graph.getOrder());
-    
-    Graph temp {graph};
 	
     while (temp.getOrder() > 0) {
-     	valid_vertices.clear();
-        for (const auto& [i, _] : temp.getAdjacencyList()) {
-            valid_vertices.push_back(i);
-        }
-       
-        chosen_vertex = valid_vertices[getRandomInt(0, valid_vertices.size() - 1)];
+        chosen_vertex = temp.getVertex(getRandomInt(0, temp.getOrder() - 1));
 		
         if (temp.getVertexDegree(chosen_vertex) == 0) {
         	solution.genes[chosen_vertex] = 3;
@@ -149,34 +143,20 @@ Chromosome TripleRomanDomination::heuristic2(const Graph& graph) {
         else {
         	solution.genes[chosen_vertex] = 4;
 
-		    for (const auto& it: temp.getAdjacencyList(chosen_vertex)) {
-		        if (solution.genes[it] == -1) {
-		            solution.genes[it] = 0;
+		    for (const auto& neighbor : graph.getAdjacencyList(chosen_vertex)) {
+		        if (temp.vertexExists(neighbor)) {
+		            solution.genes[neighbor] = 0;
 		        }
 		    }
 		}
 		
-        temp.deleteAdjacencyList(chosen_vertex);
         temp.deleteAdjacencyList(chosen_vertex);
         temp.deleteVertex(chosen_vertex);
 
-       	std::vector<size_t> vertices_to_remove;
-        
-        vertices_to_remove.reserve(temp.getOrder());
-        
-        for (const auto& [i, _]: temp.getAdjacencyList()) {
-            if (temp.getVertexDegree(i) == 0) {
-                solution.genes[i] = 3;
-                vertices_to_remove.push_back(i);
-            }
-        }
-
-        for (const auto& vertex : vertices_to_remove) {
-            temp.deleteVertex(vertex);
-        }
+        temp.deleteIsolatedVertices([&](size_t vertex) { solution.genes[vertex] = 3; });
     }
     
-    decreaseLabels(graph, solution.genes);
+    decreaseLabels(graph, solution);
     
     fitness(solution);
 	
@@ -187,88 +167,71 @@ Chromosome TripleRomanDomination::heuristic2(const Graph& graph) {
 /**
  * @brief Gera uma solução viável para o problema de Dominação Romana Tripla ordenando os vértices por grau decrescente.
  * 
- * Esta heurística utiliza um grafo auxiliar, clone do grafo original, ordena seus vértices em ordem decrescente de grau e atribui 
- * rótulo 4 ao i-ésimo vértice ordenado, e rótulo 0 aos seus vizinhos, removendo-os do grafo auxiliar. Após isso, a rotina 
+ * Esta heurística utiliza um grafo residual, ordena os vértices em ordem decrescente de grau (por contagem) e atribui 
+ * rótulo 4 ao i-ésimo vértice ordenado, e rótulo 0 aos seus vizinhos, removendo-os do grafo residual. Após isso, a rotina 
  * `decreaseLabels` tenta reduzir os rótulos da solução atual, visando diminuir seu peso.
  * 
  * @param graph Grafo utilizado para criar o cromossomo.
  * @return Chromosome Objeto que representa a solução de cromossomo gerada.
  */
  
-Chromosome TripleRomanDomination::heuristic3(const Graph& graph) {
-    Chromosome solution(Chromosome(graph.getOrder()));
+Chromosome TripleRomanDomination::heuristic3(const CSRGraph& graph) {
+    Chromosome solution(graph.getOrder());
+    ResidualGraph temp {graph};
     
-    std::vector<size_t> sorted_vertices;
+    // ordenação por contagem em ordem decrescente de grau; vértices de mesmo grau ficam em ordem crescente de índice.
+    std::vector<size_t> first_of_degree(graph.getMaxDegree() + 2, 0);
+    std::vector<size_t> sorted_vertices(graph.getOrder());
     
-    sorted_vertices.reserve(graph.getOrder());	
-    
-    Graph temp {graph};
+    for (size_t i {0}; i < graph.getOrder(); ++i) {
+        ++first_of_degree[graph.getMaxDegree() - graph.getVertexDegree(i) + 1];
+    }
     
-    size_t chosen_vertex {0};
+    for (size_t i {1}; i < first_of_degree.size(); ++i) {
+        first_of_degree[i] += first_of_degree[i - 1];
+    }
     
-   	for (const auto& [i, _] : graph.getAdjacencyList()) {
-        sorted_vertices.emplace_back(i);
+   	for (size_t i {0}; i < graph.getOrder(); ++i) {
+        sorted_vertices[first_of_degree[graph.getMaxDegree() - graph.getVertexDegree(i)]++] = i;
     }
 
-    std::sort(sorted_vertices.begin(), sorted_vertices.end(),
-        [&](size_t a, size_t b) {
-            return graph.getVertexDegree(a) > graph.getVertexDegree(b);
-    });
-
-    while ((temp.getOrder() > 0) && (chosen_vertex < sorted_vertices.size())) {
-
-        while (chosen_vertex < sorted_vertices.size() && 
-            	(!temp.vertexExists(sorted_vertices[chosen_vertex]))) {
-            ++chosen_vertex;
-        }
-
-        if (chosen_vertex >= sorted_vertices.size()) { break; };
+    for (const auto& chosen_vertex : sorted_vertices) {
+        if (temp.getOrder() == 0) { break; }
+        
+        if (!temp.vertexExists(chosen_vertex)) { continue; }
 
-	    if (temp.getVertexDegree(sorted_vertices[chosen_vertex]) == 0) {
-	        solution.genes[sorted_vertices[chosen_vertex]] = 3;
+	    if (temp.getVertexDegree(chosen_vertex) == 0) {
+	        solution.genes[chosen_vertex] = 3;
 	    }
 	    
 	    else {
-	        solution.genes[sorted_vertices[chosen_vertex]] = 4;
+	        solution.genes[chosen_vertex] = 4;
 
-	        for (const auto& it : temp.getAdjacencyList(sorted_vertices[chosen_vertex])) {
-	            if (solution.genes[it] == -1) {
-                	solution.genes[it] = 0;
+	        for (const auto& neighbor : graph.getAdjacencyList(chosen_vertex)) {
+	            if (temp.vertexExists(neighbor)) {
+                	solution.genes[neighbor] = 0;
                 }
 	        }
 	    }
 
-	    temp.deleteAdjacencyList(sorted_vertices[chosen_vertex]);
-        temp.deleteVertex(sorted_vertices[chosen_vertex++]); 
+	    temp.deleteAdjacencyList(chosen_vertex);
+        temp.deleteVertex(chosen_vertex); 
 
-	    std::vector<size_t> vertices_to_remove;
-        
-        vertices_to_remove.reserve(temp.getOrder());
-        
-        for (const auto& [i, _]: temp.getAdjacencyList()) {
-            if (temp.getVertexDegree(i) == 0) {
-                solution.genes[i] = 3;
-                vertices_to_remove.push_back(i);
-            }
-        }
-
-        for (const auto& vertex : vertices_to_remove) {
-            temp.deleteVertex(vertex);
-        }
+        temp.deleteIsolatedVertices([&](size_t vertex) { solution.genes[vertex] = 3; });
 	}
     
-    decreaseLabels(graph, solution.genes);
+    decreaseLabels(graph, solution);
 	
     fitness(solution);
 	
     return solution;
 }
 
-Graph& TripleRomanDomination::getGraph() {
+const CSRGraph& TripleRomanDomination::getGraph() {
     return this->graph;
 }
 
-std::vector<int> TripleRomanDomination::getSolutionGeneticAlgorithm() {
+std::vector<Gene> TripleRomanDomination::getSolutionGeneticAlgorithm() {
 	return this->solution_genetic_algorithm;
 }
 
@@ -283,3 +246,27 @@ float TripleRomanDomination::getGeneticAlgorithmFitnessMean() {
 float TripleRomanDomination::getGeneticAlgorithmFitnessSTD() {
     return this->genetic_algorithm_fitness_std;
 }
+
+PopulationDiversity TripleRomanDomination::getInitialDiversity() {
+    return this->genetic_algorithm.getInitialDiversity();
+}
+
+StopReason TripleRomanDomination::getStopReason() {
+    return this->genetic_algorithm.getStopReason();
+}
+
+size_t TripleRomanDomination::getGenerationsRun() {
+    return this->genetic_algorithm.getCurrentGeneration();
+}
+
+const std::vector<ProfileSnapshot>& TripleRomanDomination::getGenerationProfiles() {
+    return this->genetic_algorithm.getGenerationProfiles();
+}
+
+void TripleRomanDomination::setStoppingCriteria(const StoppingCriteria& criteria) {
+    this->genetic_algorithm.setStoppingCriteria(criteria);
+}
+
+void TripleRomanDomination::setLocalSearch(const LocalSearchSettings& settings) {
+    this->genetic_algorithm.setLocalSearch(settings);
+}
@@ -2,9 +2,32 @@
 #include "TripleRomanDomination.hpp"
 #include "Graph.hpp"             
 #include "util_functions.hpp"
+#include "ThreadPool.hpp"
+#include "GraphGenerator.hpp"
+#include "ComponentSolver.hpp"
+#include "IslandModel.hpp"
+#include "DistributedIslandModel.hpp"
+#include "ExactSolver.hpp"
+#include "LowerBounds.hpp"
+#include <cmath>
 #include <chrono>
-
-void computeGeneticAlgorithm(TripleRomanDomination& trd, short heuristic,
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+
+struct TrialResult {
+	size_t best_fitness;
+	float fitness_mean;
+	float fitness_std;
+	double elapsed_time;
+	PopulationDiversity initial_diversity;
+	size_t generations {0};
+	StopReason stop_reason {StopReason::generations};
+	std::vector<ProfileSnapshot> profile {};
+};
+
+TrialResult computeGeneticAlgorithm(TripleRomanDomination& trd, short heuristic,
 	bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
 	
     std::chrono::duration<double> elapsed_time;
@@ -17,11 +40,190 @@ void computeGeneticAlgorithm(TripleRomanDomination& trd, short heuristic,
 	
 	elapsed_time = end - start;
   	   
-	std::cout << trd.getGeneticAlgorithmBestFitness() << ',';
-	std::cout << trd.getGeneticAlgorithmFitnessMean() << ',';
-	std::cout << trd.getGeneticAlgorithmFitnessSTD() << ',';
+	return {trd.getGeneticAlgorithmBestFitness(), trd.getGeneticAlgorithmFitnessMean(),
+		trd.getGeneticAlgorithmFitnessSTD(), elapsed_time.count(), trd.getInitialDiversity(), 
+		trd.getGenerationsRun(), trd.getStopReason(), trd.getGenerationProfiles()};
+}
+
+// executa uma tentativa com o modelo de ilhas, local (`IslandModel`) ou distribuído (`DistributedIslandModel`).
+
+template <typename Model>
+TrialResult computeIslandModel(Model& model, short heuristic,
+	bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
+	
+	auto start = std::chrono::high_resolution_clock::now();
+	
+	model.run(TripleRomanDomination::getHeuristics(), heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+	
+	std::chrono::duration<double> elapsed_time { std::chrono::high_resolution_clock::now() - start };
+	
+	return {model.getBestFitness(), model.getFitnessMean(), model.getFitnessSTD(), elapsed_time.count(), 
+		model.getInitialDiversity()};
+}
+
+// lê a topologia de migração do modelo de ilhas: `ring` (padrão), `full` ou `random`.
+
+MigrationTopology parseTopology(const std::string& name) {
+	if (name == "ring") {
+		return MigrationTopology::ring;
+	}
+	
+	if (name == "full") {
+		return MigrationTopology::full;
+	}
+	
+	if (name == "random") {
+		return MigrationTopology::random;
+	}
+	
+	throw std::invalid_argument("Invalid topology: " + name);
+}
+
+// executa uma tentativa sobre as componentes conexas do grafo, uma a uma; ver `ComponentSolver`.
+
+TrialResult computeDecomposedGeneticAlgorithm(const ComponentSolver& solver, uint64_t seed, short heuristic,
+	bool flag_elitism, bool flag_selection, bool flag_crossover, bool flag_mutation) {
+	
+	auto start = std::chrono::high_resolution_clock::now();
+	
+	ComponentSolution solution { solver.solve(seed, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation) };
+	
+	std::chrono::duration<double> elapsed_time { std::chrono::high_resolution_clock::now() - start };
+	
+	return {solution.best_fitness, solution.fitness_mean, solution.fitness_std, elapsed_time.count(), 
+		solution.initial_diversity};
+}
+
+// `lower_bound` é o melhor limite inferior conhecido do peso ótimo; `optimum` é o peso ótimo comprovado por `--exact`,
+// ou -1 quando ele não é conhecido; nesse caso o gap também é -1.
+
+void printTrialResult(const TrialResult& result, size_t lower_bound, long optimum) {
+	std::cout << result.best_fitness << ',';
+	std::cout << result.fitness_mean << ',';
+	std::cout << result.fitness_std << ',';
+	std::cout << result.elapsed_time << ',';
+	std::cout << result.generations << ',';
+	std::cout << stopReasonName(result.stop_reason) << ',';
+	std::cout << lower_bound << ',';
+	std::cout << optimum << ',';
+
+	if (optimum > 0) {
+		std::cout << (static_cast<double>(result.best_fitness) - optimum) / optimum << '\n';
+	}
+
+	else {
+		std::cout << -1 << '\n';
+	}
+}
+
+// grava o perfil de cada geração de cada execução em `filename`, uma linha JSON por geração, na ordem das execuções. 
+// A geração 0 é a criação da população inicial; `elapsed_ns` é o tempo total da geração, e o de cada fase soma o 
+// tempo de todas as threads.
+
+void writeProfile(const std::string& filename, const std::vector<TrialResult>& results) {
+	std::ofstream file(filename);
+	
+	if (!file) {
+		throw std::runtime_error("Could not open profile file: " + filename);
+	}
+	
+	for (size_t trial {0}; trial < results.size(); ++trial) {
+		for (size_t generation {0}; generation < results[trial].profile.size(); ++generation) {
+			const ProfileSnapshot& snapshot { results[trial].profile[generation] };
+			
+			file << "{\"trial\":" << trial << ",\"generation\":" << generation 
+				<< ",\"elapsed_ns\":" << snapshot.elapsed_nanoseconds << ",\"phases\":{";
+			
+			for (size_t phase {0}; phase < phase_count; ++phase) {
+				file << (phase > 0 ? "," : "") << '"' << phaseName(static_cast<Phase>(phase)) << "\":{\"ns\":" 
+					<< snapshot.nanoseconds[phase] << ",\"calls\":" << snapshot.calls[phase] << '}';
+			}
+			
+			file << "},\"counters\":{";
+			
+			for (size_t counter {0}; counter < counter_count; ++counter) {
+				file << (counter > 0 ? "," : "") << '"' << counterName(static_cast<Counter>(counter)) << "\":" 
+					<< snapshot.counters[counter];
+			}
+			
+			file << "}}\n";
+		}
+	}
+}
+
+// lê as opções opcionais no formato `--chave=valor` (ou apenas `--chave`) a partir de `first`.
+
+std::unordered_map<std::string, std::string> parseOptions(int argc, char** argv, int first) {
+	std::unordered_map<std::string, std::string> options;
+	
+	for (int i {first}; i < argc; ++i) {
+		std::string argument { argv[i] };
+		
+		if (argument.rfind("--", 0) != 0) {
+			throw std::invalid_argument("Invalid option: " + argument);
+		}
+		
+		size_t equal { argument.find('=') };
+		
+		if (equal == std::string::npos) {
+			options[argument.substr(2)] = "1";
+		}
+		
+		else {
+			options[argument.substr(2, equal - 2)] = argument.substr(equal + 1);
+		}
+	}
+	
+	return options;
+}
 
-	std::cout << elapsed_time.count() << '\n';
+// carrega o grafo de um arquivo de arestas ou de um cache binário `.trdg`. Com `use_cache`, o cache 
+// `<arquivo>.trdg` é usado quando é mais novo que o arquivo de arestas; caso contrário, é (re)gerado.
+
+CSRGraph loadGraph(const std::string& filename, bool use_cache, size_t threads) {
+	if (!use_cache || CSRGraph::isBinaryFile(filename)) {
+		return CSRGraph(filename, threads);
+	}
+	
+	const std::string cache_filename { filename + ".trdg" };
+	std::error_code error;
+	
+	if (std::filesystem::exists(cache_filename, error) && 
+			std::filesystem::last_write_time(cache_filename, error) >= std::filesystem::last_write_time(filename, error) &&
+			!error) {
+		return CSRGraph(cache_filename, threads);
+	}
+	
+	CSRGraph graph(filename, threads);
+	graph.save(cache_filename);
+	
+	return graph;
+}
+
+// gera o grafo aleatório da parte 5 com o modelo escolhido em `--generator`:
+// `gnp` (G(n, p), padrão), `ba` (Barabási–Albert) ou `geometric` (grafo geométrico aleatório).
+
+CSRGraph generateGraph(std::unordered_map<std::string, std::string>& options, size_t order, uint64_t seed) {
+	std::string generator { options.count("generator") ? options["generator"] : "gnp" };
+	
+	if (generator == "gnp") {
+		double probability { options.count("edge-probability") ? std::stod(options["edge-probability"]) : 0.5 };
+		return generateErdosRenyiGraph(order, probability, seed);
+	}
+	
+	if (generator == "ba") {
+		size_t attachment { options.count("attachment") ? std::stoul(options["attachment"]) : 2 };
+		return generateBarabasiAlbertGraph(order, attachment, seed);
+	}
+	
+	if (generator == "geometric") {
+		// por padrão, um raio um pouco acima do limiar de conectividade, sqrt(ln n / (pi n)).
+		double radius { options.count("radius") ? std::stod(options["radius"]) : 
+			std::sqrt(2.0 * std::log(static_cast<double>(order)) / (std::acos(-1.0) * order)) };
+		return generateGeometricGraph(order, radius, seed);
+	}
+	
+	throw std::invalid_argument("Invalid generator: " + generator);
 }
 
 /*
@@ -110,28 +312,107 @@ void computeGeneticAlgorithm(TripleRomanDomination& trd, short heuristic,
 
 auto main(int argc, char** argv) -> int {
 
-    // argumentos: caminho_do_grafo nome_do_grafo flag_elitism flag_selection flag_crossover flag_mutation graph_order
+    // argumentos: caminho_do_grafo nome_do_grafo flag_elitism flag_selection flag_crossover flag_mutation graph_order [opções]
     // graph order deve ser pelo menos 5.
-
-    if (argc > 6) {
-        Graph graph;
+    // opções: --threads=N     número de execuções (trials) simultâneas (padrão: número de núcleos).
+    //         --ga-threads=N  número de threads que geram a população inicial e a prole dentro de cada execução (padrão: 1).
+    //         --seed=S        semente que torna a execução reprodutível.
+    //         --graph-cache   usa (ou cria) o cache binário `<caminho_do_grafo>.trdg` ao ler o grafo.
+    //         --generator=G   modelo do grafo aleatório: gnp (padrão), ba ou geometric; parâmetros em
+    //                         --edge-probability=P (gnp, padrão 0.5), --attachment=M (ba, padrão 2) e --radius=R (geometric).
+    //         --save-graph=F  grava o grafo usado no formato binário `.trdg`.
+    //         --diversity     informa, na saída de erro, a diversidade da população inicial de cada execução.
+    //         --decompose     resolve cada componente conexa separadamente: as com até --exact-order=K vértices
+    //                         (padrão 10) de forma exata, com o limite --exact-node-limit, e as demais (ou as que
+    //                         não fecham no limite) com um algoritmo genético cada, em paralelo em --ga-threads
+    //                         threads. Não pode ser combinado com --islands nem com --transport.
+    //         --islands=K     evolui K populações (ilhas) em --ga-threads threads, trocando os --migrants=N (padrão 2)
+    //                         melhores indivíduos a cada --migration-interval=M (padrão 50) gerações na topologia
+    //                         --topology=T: ring (padrão), full ou random.
+    //         --stagnation=N  encerra uma execução após N gerações sem melhora do melhor fitness.
+    //         --stop-at-lower-bound  encerra uma execução quando o melhor fitness alcança o limite inferior da
+    //                         coluna `lower_bound` (ver `LowerBounds`), que com --exact é o ótimo comprovado.
+    //         --time-limit=S  encerra uma execução após S segundos.
+    //         --max-evaluations=E  encerra uma execução após E indivíduos avaliados.
+    //         --local-search=R  aplica a busca local memética a cada filho com probabilidade R, avaliando no máximo
+    //                         --local-search-budget=B movimentos (padrão 0, sem limite), a cada
+    //                         --local-search-interval=K gerações (padrão 1), em todos os modos: cada ilha e cada
+    //                         componente grande usa a mesma configuração.
+    //                         Os critérios de parada valem só para o algoritmo genético de uma população e são recusados
+    //                         com --islands, --transport e --decompose; as colunas `generations` e `stop_reason`
+    //                         informam quantas gerações rodaram e o critério que parou.
+    //         --exact         calcula antes das execuções uma FDRT ótima com o resolvedor exato, explorando no máximo
+    //                         --exact-node-limit=N nós por componente (padrão 10^6, 0 sem limite); as colunas 
+    //                         `optimum` e `gap` trazem o ótimo comprovado e o gap relativo de cada execução, ou -1.
+    //                         O limite padrão basta para G(n, p) esparsos de até cerca de 80 vértices e grafos 
+    //                         geométricos ou de preferência de algumas centenas; G(n, p) esparsos com 100 vértices 
+    //                         costumam atingi-lo, e grafos densos não são resolvidos.
+    //         --profile=F     grava em F, em JSON, os tempos e contadores de cada fase em cada geração; exige a
+    //                         compilação com `make INSTRUMENT=1` e vale só para o algoritmo genético de uma população:
+    //                         é recusado com --islands, --transport e --decompose.
+    //         --transport=A   cada processo é uma ilha, e os processos trocam imigrantes por A: unix:<caminho>,
+    //                         tcp:<host>:<porta> ou mpi. Com sockets, --rank=R e --processes=P identificam o processo;
+    //                         as execuções são sequenciais, e só o processo 0 imprime o resultado.
+
+    if (argc > 7) {
+        auto options { parseOptions(argc, argv, 8) };
+        
+        // uma única semente determina o grafo aleatório e todas as execuções; sem `--seed`, uma é sorteada e 
+        // informada na saída de erro para que a execução possa ser reproduzida.
+        uint64_t seed {0};
+        
+        if (options.count("seed")) {
+            seed = std::stoull(options["seed"]);
+        }
+        
+        else {
+            seed = (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+            std::cerr << "seed=" << seed << '\n';
+        }
 	
         // se for 0, então é umas das partes, 1 a 4.
         bool part5 { std::stoi(argv[7]) > 0 ? true : false };
         
-        // pega o grafo do arquivo, senão, gera um com `graph_order`
-        if (part5) {
-			graph = Graph(std::stoi(argv[7]), 0.5);
-        } 
+        size_t threads { options.count("threads") ? std::stoul(options["threads"]) : ThreadPool::defaultThreadCount() };
+        size_t ga_threads { options.count("ga-threads") ? std::stoul(options["ga-threads"]) : 1 };
         
-        else {
-            // grafo gerado aleatoriamente com (ordem, probabilidade de conexão entre arestas).
-            graph = Graph(argv[1]);
-        }
+        // pega o grafo do arquivo, senão, gera um com `graph_order`.
+        const CSRGraph graph { part5 ? 
+        	generateGraph(options, std::stoul(argv[7]), mixSeed(seed, 0)) : 
+        	loadGraph(argv[1], options.count("graph-cache") > 0, threads) };
 
         if (graph.getOrder() == 0) {
             return -1;
         }
+        
+#ifndef TRD_INSTRUMENTATION
+        if (options.count("profile")) {
+            throw std::invalid_argument("Profiling not available: build with `make INSTRUMENT=1`");
+        }
+#endif
+        
+        // os critérios de parada e o perfil só existem no algoritmo genético de uma população; nos demais modos eles 
+        // seriam ignorados, e a execução seria informada como completa ou o perfil sairia vazio.
+        bool single_population { !options.count("transport") && !options.count("decompose") &&
+            (!options.count("islands") || std::stoul(options["islands"]) <= 1) };
+        
+        for (const char* option : {"stagnation", "time-limit", "max-evaluations", "stop-at-lower-bound", "profile"}) {
+            if (options.count(option) && !single_population) {
+                throw std::invalid_argument(std::string("--") + option + 
+                    " is not supported with --islands, --transport or --decompose");
+            }
+        }
+        
+        // a decomposição roda um algoritmo genético de uma população por componente; as ilhas ou os processos 
+        // seriam ignorados.
+        if (options.count("decompose") && (options.count("transport") || 
+                (options.count("islands") && std::stoul(options["islands"]) > 1))) {
+            throw std::invalid_argument("--decompose is not supported with --islands or --transport");
+        }
+        
+        if (options.count("save-graph")) {
+            graph.save(options["save-graph"]);
+        }
 
         constexpr size_t trial {20};
 
@@ -149,12 +430,135 @@ auto main(int argc, char** argv) -> int {
         bool flag_selection = std::stoi(argv[4]); 
         bool flag_crossover = std::stoi(argv[5]);
         bool flag_mutation = std::stoi(argv[6]);
-
-        TripleRomanDomination trd(graph, population_size, graph.getOrder(), generations,
-            elitism_rate, crossover_rate, mutation_rate, tournament_population_size);
-
-        for (size_t i {0}; i < trial; ++i) {   
-            computeGeneticAlgorithm(trd, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);       
+        
+        // cada execução tem seu próprio fluxo aleatório, derivado da semente.
+        uint64_t trials_seed { mixSeed(seed, 1) };
+        
+        std::vector<TrialResult> results(trial);
+        
+        // limite de nós do resolvedor exato, com --exact e nas componentes pequenas de --decompose.
+        size_t exact_node_limit { options.count("exact-node-limit") ? std::stoul(options["exact-node-limit"]) : 1000000 };
+        
+        // a decomposição e as componentes pequenas são resolvidas uma única vez, antes das execuções.
+        std::unique_ptr<ComponentSolver> solver;
+        
+        if (options.count("decompose")) {
+            size_t exact_order { options.count("exact-order") ? std::stoul(options["exact-order"]) : 10 };
+            solver = std::make_unique<ComponentSolver>(graph, population_size, generations, elitism_rate, crossover_rate,
+                mutation_rate, tournament_population_size, ga_threads, exact_order, exact_node_limit);
+        }
+        
+        // os limites inferiores e o ótimo, quando pedido, são calculados uma única vez e valem para todas as execuções.
+        const LowerBounds bounds(graph, threads);
+        size_t lower_bound { bounds.getBound() };
+        long optimum {-1};
+        
+        if (options.count("exact")) {
+            ExactSolver exact(graph, exact_node_limit, &bounds);
+            
+            if (exact.solve()) {
+                optimum = static_cast<long>(exact.getWeight());
+            }
+            
+            lower_bound = std::max(lower_bound, exact.getLowerBound());
+            
+            std::cerr << "exact_weight=" << exact.getWeight() << " lower_bound=" << exact.getLowerBound() 
+                << " optimal=" << exact.isOptimal() << " nodes=" << exact.getNodeCount() << '\n';
+        }
+        
+        StoppingCriteria stopping_criteria;
+        stopping_criteria.stagnation_generations = options.count("stagnation") ? std::stoul(options["stagnation"]) : 0;
+        stopping_criteria.time_limit = options.count("time-limit") ? std::stod(options["time-limit"]) : 0.0;
+        stopping_criteria.max_evaluations = options.count("max-evaluations") ? std::stoul(options["max-evaluations"]) : 0;
+        
+        if (options.count("stop-at-lower-bound")) {
+            stopping_criteria.lower_bound = lower_bound;
+        }
+        
+        LocalSearchSettings local_search;
+        local_search.rate = options.count("local-search") ? std::stof(options["local-search"]) : 0.0f;
+        local_search.budget = options.count("local-search-budget") ? std::stoul(options["local-search-budget"]) : 0;
+        local_search.interval = options.count("local-search-interval") ? std::stoul(options["local-search-interval"]) : 1;
+        
+        if (solver) {
+            solver->setLocalSearch(local_search);
+        }
+        
+        size_t islands { options.count("islands") ? std::stoul(options["islands"]) : 1 };
+        size_t migration_interval { options.count("migration-interval") ? std::stoul(options["migration-interval"]) : 50 };
+        size_t migrants { options.count("migrants") ? std::stoul(options["migrants"]) : 2 };
+        MigrationTopology topology { parseTopology(options.count("topology") ? options["topology"] : "ring") };
+        
+        std::unique_ptr<Transport> transport;
+        
+        if (options.count("transport")) {
+            size_t rank { options.count("rank") ? std::stoul(options["rank"]) : 0 };
+            size_t processes { options.count("processes") ? std::stoul(options["processes"]) : 1 };
+            transport = createTransport(options["transport"], rank, processes);
+        }
+        
+        // no modelo distribuído, todos os processos participam de cada execução, uma de cada vez.
+        for (size_t i {0}; transport && i < trial; ++i) {
+            DistributedIslandModel model(*transport, graph, population_size, graph.getOrder(), generations, elitism_rate, 
+                crossover_rate, mutation_rate, tournament_population_size, mixSeed(trials_seed, i), 
+                migration_interval, migrants, topology);
+            
+            model.setLocalSearch(local_search);
+                
+            results[i] = computeIslandModel(model, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+            results[i].generations = generations;
+        }
+        
+        if (transport && transport->getRank() != 0) {
+            return EXIT_SUCCESS;
+        }
+        
+        ThreadPool pool(std::min(threads, trial));
+        
+        pool.parallelFor(transport ? 0 : trial, [&](size_t i) {
+            if (solver) {
+                results[i] = computeDecomposedGeneticAlgorithm(*solver, mixSeed(trials_seed, i), heuristic, 
+                    flag_elitism, flag_selection, flag_crossover, flag_mutation);
+                results[i].generations = generations;
+                return;
+            }
+            
+            if (islands > 1) {
+                IslandModel model(graph, islands, population_size, graph.getOrder(), generations, elitism_rate, 
+                    crossover_rate, mutation_rate, tournament_population_size, mixSeed(trials_seed, i), 
+                    migration_interval, migrants, topology, ga_threads);
+                
+                model.setLocalSearch(local_search);
+                    
+                results[i] = computeIslandModel(model, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+                results[i].generations = generations;
+                return;
+            }
+            
+            TripleRomanDomination trd(graph, population_size, graph.getOrder(), generations,
+                elitism_rate, crossover_rate, mutation_rate, tournament_population_size, mixSeed(trials_seed, i), ga_threads);
+            
+            trd.setStoppingCriteria(stopping_criteria);
+            trd.setLocalSearch(local_search);
+                
+            results[i] = computeGeneticAlgorithm(trd, heuristic, flag_elitism, flag_selection, flag_crossover, flag_mutation);
+        });
+
+        // as linhas do CSV são impressas na ordem das execuções, independentemente da ordem de término.
+        for (const auto& result : results) {   
+            printTrialResult(result, lower_bound, optimum);
+        }
+        
+        if (options.count("profile")) {
+            writeProfile(options["profile"], results);
+        }
+        
+        // a diversidade vai para a saída de erro para não alterar as colunas do CSV.
+        if (options.count("diversity")) {
+            for (size_t i {0}; i < trial; ++i) {
+                std::cerr << "trial=" << i << " distinct_genomes=" << results[i].initial_diversity.distinct_genomes 
+                    << " mean_hamming_distance=" << results[i].initial_diversity.mean_hamming_distance << '\n';
+            }
         }
 
         return EXIT_SUCCESS;
@@ -162,4 +566,3 @@ auto main(int argc, char** argv) -> int {
 
     return -1;
 }
-
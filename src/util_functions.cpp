@@ -1,20 +1,37 @@
 
 #include "util_functions.hpp"  
+#include "Profile.hpp"
 
-std::random_device rd;
-std::mt19937 seed(rd());
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+// cada thread tem seu próprio gerador, de modo que execuções concorrentes não compartilham estado.
+// Quem precisa de resultados reprodutíveis chama `setRandomSeed` antes de usá-lo.
+thread_local Xoshiro256 generator(std::random_device{}());
+
+void setRandomSeed(uint64_t value) {
+    generator.seed(value);
+}
+
+Xoshiro256& getRandomEngine() {
+    return generator;
+}
 
 size_t getRandomInt(size_t start, size_t end) {
     std::uniform_int_distribution<size_t> gap(start, end);
-    return gap(seed);
+    return gap(generator);
 }
 
 float getRandomFloat(float start, float end) {
     std::uniform_real_distribution<float> gap(start, end);
-    return gap(seed);
+    return gap(generator);
 }
 
-bool feasible(const Graph& graph, const std::vector<int>& solution) {
+bool feasible(const CSRGraph& graph, const std::vector<Gene>& solution) {
 	for (size_t i {0}; i < solution.size(); ++i) {
 		if (!feasible(graph, solution, i)) {
 			return false;
@@ -24,16 +41,6 @@ bool feasible(const Graph& graph, const std::vector<int>& solution) {
 	return true;
 }
 
-bool activeNeighborhoodIsFeasible(const Graph& graph, const std::vector<int>& solution, const std::vector<int>& active_neighbors) {
-	for (const auto& vertex: active_neighbors) {
-		if (!feasible(graph, solution, vertex)) {
-			return false;
-		}	
-	}
-	
-	return true;
-}
-
 /**
  * @brief Checks if a vertex label in the solution is feasible based on its neighbors.
  * @details This function checks the feasibility of a vertex label in the solution according to the rules 
@@ -54,7 +61,9 @@ bool activeNeighborhoodIsFeasible(const Graph& graph, const std::vector<int>& so
  * @return `true` if the vertex label is feasible, `false` otherwise.
  */
  
-bool feasible(const Graph& graph, const std::vector<int>& solution, size_t vertex) {
+bool feasible(const CSRGraph& graph, const std::vector<Gene>& solution, size_t vertex) {
+	TRD_PROFILE_COUNT(feasible_calls, 1);
+	
 	size_t active {0};
 	size_t sum_weight = solution[vertex];	
 	for (const auto& it: graph.getAdjacencyList(vertex)) {
@@ -78,83 +87,178 @@ bool feasible(const Graph& graph, const std::vector<int>& solution, size_t verte
 	}	
 }
 
+/**
+ * @brief Same check as `feasible(graph, solution, vertex)`, answered in O(1) from the chromosome 
+ * neighborhood cache when it is active.
+ */
+
+bool feasible(const CSRGraph& graph, const Chromosome& chromosome, size_t vertex) {
+	if (!chromosome.hasNeighborhoodCache()) {
+		return feasible(graph, chromosome.genes, vertex);
+	}
+	
+	TRD_PROFILE_COUNT(feasible_calls, 1);
+	
+	const NeighborhoodWeight& weight { chromosome.neighborhood[vertex] };
+	
+	return chromosome.genes[vertex] + weight.label_sum >= 3 + weight.active;
+}
 
 /**
- * @brief Checks the feasibility of a chromosome and adjusts if it isn't feasible.
+ * @brief Checks whether relabelling `vertex` with `label` keeps the vertex and all of its neighbors feasible, 
+ * without modifying the chromosome. Requires the neighborhood cache and runs in O(deg(vertex)).
+ */
+
+static bool labelChangeIsFeasible(const CSRGraph& graph, const Chromosome& chromosome, size_t vertex, int label) {
+	const NeighborhoodWeight& weight { chromosome.neighborhood[vertex] };
+	
+	if (label + weight.label_sum < 3 + weight.active) {
+		return false;
+	}
+	
+	int old_label { chromosome.genes[vertex] };
+	int label_delta { label - old_label };
+	int active_delta { (label > 0 ? 1 : 0) - (old_label > 0 ? 1 : 0) };
+	
+	for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+		const NeighborhoodWeight& neighbor_weight { chromosome.neighborhood[neighbor] };
+		
+		if (static_cast<int>(chromosome.genes[neighbor] + neighbor_weight.label_sum) + label_delta < 
+			static_cast<int>(3 + neighbor_weight.active) + active_delta) {
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+
+/**
+ * @brief Repairs the label of a single vertex if it violates the Triple Roman Domination constraints.
  * 
- * Adjusts genes based on the adjacency list of the graph, ensuring that constraints of Triple Roman Domination are met.
+ * A vertex labelled `0` is raised to `2` or `3` and a vertex labelled `2` is raised to `3`, depending on the 
+ * labels of its neighbors. Labels are only ever increased, so repairing a vertex never breaks a neighbor that 
+ * was already valid. The chromosome fitness is adjusted by the label difference. When the chromosome carries 
+ * its neighborhood cache the check is O(1).
  * 
- * @param chromosome A reference to the chromosome to be checked.
- * @return Chromosome The adjusted chromosome.
+ * @param graph The graph used to check the adjacency of the vertex.
+ * @param chromosome The chromosome whose gene may be repaired.
+ * @param vertex The index of the vertex to be repaired.
  */
 
-Chromosome& feasibilityCheck(const Graph& graph, Chromosome& chromosome) {  
+void repairLabel(const CSRGraph& graph, Chromosome& chromosome, size_t vertex) {
     bool is_valid {false};
     bool has_neighbor_at_least_2 {false};
-                                                           
-    for (size_t i {0}; i < chromosome.genes.size(); ++i) {		
-    	is_valid = false;
- 		
-        if (chromosome.genes[i] == 0) {    
-            size_t count_neighbors_2 {0};
-            size_t count_neighbors_3 {0};
-            
-            for (auto& neighbor : graph.getAdjacencyList(i)) {          
-                if (chromosome.genes[neighbor] == 4) {
-                 	is_valid = true;
-                    break;
-                }
-                                                         	                        
-                if ((count_neighbors_2 == 1 && chromosome.genes[neighbor] >= 3) ||
-                    (count_neighbors_2 == 2 && chromosome.genes[neighbor] >= 2)) {
-                    is_valid = true;
-                    break;
-                }
-                                                                                 
-                if (count_neighbors_3 == 1 && chromosome.genes[neighbor] >= 2) {
-                 	is_valid = true;
-                 	break;
-                }
-                                                                                 
-                if (chromosome.genes[neighbor] == 3) {
-                    ++count_neighbors_3;
-                }
-                    
-                if (chromosome.genes[neighbor] == 2) {
-                    ++count_neighbors_2;
-                }
-            }
+    
+    if (chromosome.hasNeighborhoodCache()) {
+        const NeighborhoodWeight& weight { chromosome.neighborhood[vertex] };
+        
+        if (chromosome.genes[vertex] == 0) {
+            is_valid = weight.neighbors_4 > 0 || weight.neighbors_2 >= 3 ||
+                (weight.neighbors_3 >= 1 && weight.neighbors_2 + weight.neighbors_3 >= 2);
             
             if (!is_valid) {
-            	if (count_neighbors_3 == 0) {
-            		if (count_neighbors_2 == 0) {
-            			chromosome.genes[i] = 3;
-            		}
-            			
-            		else if (count_neighbors_2 > 0) {
-            			chromosome.genes[i] = 2;
-            		}
-            	} 
-            	
-            	else if (count_neighbors_3 == 1) {
-            		chromosome.genes[i] = 2;
-            	}
+                chromosome.setGene(graph, vertex, (weight.neighbors_2 + weight.neighbors_3 > 0) ? 2 : 3);
             }
         }
+        
+        else if (chromosome.genes[vertex] == 2 && weight.neighbors_2 + weight.neighbors_3 + weight.neighbors_4 == 0) {
+            chromosome.setGene(graph, vertex, 3);
+        }
+        
+        return;
+    }
+ 		
+    if (chromosome.genes[vertex] == 0) {    
+        size_t count_neighbors_2 {0};
+        size_t count_neighbors_3 {0};
+        
+        for (auto& neighbor : graph.getAdjacencyList(vertex)) {          
+            if (chromosome.genes[neighbor] == 4) {
+             	is_valid = true;
+                break;
+            }
+                                                     	                        
+            if ((count_neighbors_2 == 1 && chromosome.genes[neighbor] >= 3) ||
+                (count_neighbors_2 == 2 && chromosome.genes[neighbor] >= 2)) {
+                is_valid = true;
+                break;
+            }
+                                                                             
+            if (count_neighbors_3 == 1 && chromosome.genes[neighbor] >= 2) {
+             	is_valid = true;
+             	break;
+            }
+                                                                             
+            if (chromosome.genes[neighbor] == 3) {
+                ++count_neighbors_3;
+            }
+                
+            if (chromosome.genes[neighbor] == 2) {
+                ++count_neighbors_2;
+            }
+        }
+        
+        if (!is_valid) {
+        	if (count_neighbors_3 == 0) {
+        		if (count_neighbors_2 == 0) {
+        			chromosome.setGene(graph, vertex, 3);
+        		}
+        			
+        		else if (count_neighbors_2 > 0) {
+        			chromosome.setGene(graph, vertex, 2);
+        		}
+        	} 
+        	
+        	else if (count_neighbors_3 == 1) {
+        		chromosome.setGene(graph, vertex, 2);
+        	}
+        }
+    }
 
-        else if (chromosome.genes[i] == 2) {
-            has_neighbor_at_least_2 = false;
-            for (auto& neighbor : graph.getAdjacencyList(i)) {
-                if (chromosome.genes[neighbor] >= 2) {
-                    has_neighbor_at_least_2 = true;
-                    break; 
-                }
+    else if (chromosome.genes[vertex] == 2) {
+        for (auto& neighbor : graph.getAdjacencyList(vertex)) {
+            if (chromosome.genes[neighbor] >= 2) {
+                has_neighbor_at_least_2 = true;
+                break; 
             }
-                                                                                 
-            if (!has_neighbor_at_least_2) {
-                chromosome.genes[i] = 3;
-            }           
         }
+                                                                             
+        if (!has_neighbor_at_least_2) {
+            chromosome.setGene(graph, vertex, 3);
+        }           
+    }
+}
+
+/**
+ * @brief `repairLabel`, counting the raised label in the instrumentation build.
+ */
+
+static void repairCounted(const CSRGraph& graph, Chromosome& chromosome, size_t vertex) {
+#ifdef TRD_INSTRUMENTATION
+    Gene label { chromosome.genes[vertex] };
+    repairLabel(graph, chromosome, vertex);
+    TRD_PROFILE_COUNT(repaired_labels, chromosome.genes[vertex] != label);
+#else
+    repairLabel(graph, chromosome, vertex);
+#endif
+}
+
+/**
+ * @brief Checks the feasibility of a chromosome and adjusts if it isn't feasible.
+ * 
+ * Adjusts genes based on the adjacency list of the graph, ensuring that constraints of Triple Roman Domination are met.
+ * 
+ * @param chromosome A reference to the chromosome to be checked.
+ * @return Chromosome The adjusted chromosome.
+ */
+
+Chromosome& feasibilityCheck(const CSRGraph& graph, Chromosome& chromosome) {  
+    TRD_PROFILE_PHASE(repair);
+    TRD_PROFILE_COUNT(repair_calls, 1);
+    
+    for (size_t i {0}; i < chromosome.genes.size(); ++i) {		
+    	repairCounted(graph, chromosome, i);
     }
     
     fitness(chromosome);
@@ -162,99 +266,432 @@ Chromosome& feasibilityCheck(const Graph& graph, Chromosome& chromosome) {
     return chromosome;
 }
 
-void decreaseLabels(const Graph& graph, std::vector<int>& solution) {
-	for (const auto& vertex : solution) {
-	    decreaseLabel(graph, solution, vertex);
+/**
+ * @brief Repairs the closed neighborhoods of `count` changed vertices, in increasing index order.
+ * 
+ * The candidate list is a thread-local scratch buffer, so the steady state does not allocate.
+ */
+
+static void repairNeighborhoods(const CSRGraph& graph, Chromosome& chromosome, const size_t* changed_vertices, size_t count) {
+    // reutilizado entre chamadas para não alocar memória a cada reparo.
+    thread_local std::vector<size_t> candidates;
+    candidates.clear();
+    
+    for (size_t i {0}; i < count; ++i) {
+        candidates.push_back(changed_vertices[i]);
+        
+        for (const auto& neighbor : graph.getAdjacencyList(changed_vertices[i])) {
+            candidates.push_back(neighbor);
+        }
+    }
+    
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    
+    for (const auto& vertex : candidates) {
+        repairCounted(graph, chromosome, vertex);
+    }
+}
+
+/**
+ * @brief Incremental version of `feasibilityCheck` for a chromosome that was feasible before `changed_vertices` were relabelled.
+ * 
+ * Only the closed neighborhoods of the changed vertices can hold violated labels, so only those vertices are 
+ * repaired, in increasing index order. Because repairs only raise labels, this produces exactly the same genes 
+ * as the full check, at a cost proportional to the degrees of the changed vertices instead of the graph size.
+ * 
+ * @param graph The graph used to check the adjacency of the vertices.
+ * @param chromosome The chromosome to be repaired. Its fitness must already account for the changed genes.
+ * @param changed_vertices The vertices whose labels were modified since the chromosome was last feasible.
+ * @return Chromosome The adjusted chromosome.
+ */
+
+Chromosome& feasibilityCheck(const CSRGraph& graph, Chromosome& chromosome, const std::vector<size_t>& changed_vertices) {
+    TRD_PROFILE_PHASE(repair);
+    TRD_PROFILE_COUNT(repair_calls, 1);
+    
+    repairNeighborhoods(graph, chromosome, changed_vertices.data(), changed_vertices.size());
+    
+    return chromosome;
+}
+
+/**
+ * @brief Incremental `feasibilityCheck` for a single relabelled vertex, as done by the mutation operators.
+ */
+
+Chromosome& feasibilityCheck(const CSRGraph& graph, Chromosome& chromosome, size_t changed_vertex) {
+    TRD_PROFILE_PHASE(repair);
+    TRD_PROFILE_COUNT(repair_calls, 1);
+    
+    repairNeighborhoods(graph, chromosome, &changed_vertex, 1);
+    
+    return chromosome;
+}
+
+/**
+ * @brief Tries to decrease the label of every vertex of the solution, in increasing index order.
+ * 
+ * The chromosome neighborhood cache is built for the duration of the call (and dropped afterwards if it was 
+ * not active before), so each vertex costs O(deg) and the whole pass is O(n + m).
+ */
+
+void decreaseLabels(const CSRGraph& graph, Chromosome& chromosome) {
+	bool had_cache { chromosome.hasNeighborhoodCache() };
+	
+	if (!had_cache) {
+		chromosome.buildNeighborhoodCache(graph);
+	}
+	
+	for (size_t vertex {0}; vertex < chromosome.genes.size(); ++vertex) {
+	    decreaseLabel(graph, chromosome, vertex);
+	}
+	
+	if (!had_cache) {
+		chromosome.clearNeighborhoodCache();
 	}
 }
 
 /**
  * @brief Attempts to change the label of a vertex in the solution while ensuring feasibility.
  * 
- * This function modifies the label of a specific vertex to 0 and checks if the solution 
- * remains feasible. If the solution becomes infeasible, it tries setting the vertex label 
- * to 2, and if still infeasible, to 3. If none of these labels result in a feasible solution, 
- * it reverts the vertex label to its initial value.
+ * This function tries the labels 0, 2 and 3 (below the current one), in this order, and picks the first one 
+ * that keeps the vertex feasible. If none does, or if the chosen label makes any neighbor infeasible, the 
+ * vertex keeps its initial label.
  * 
  * @param graph The graph that contains the vertex whose label is being modified.
- * @param solution The vector representing the current labeling of the solution, where each element 
- *                 corresponds to the label of a vertex in the graph.
+ * @param chromosome The current solution. Its neighborhood cache must be active.
  * @param vertex The index of the vertex whose label is being decreased.
+ */
+
+void decreaseLabel(const CSRGraph& graph, Chromosome& chromosome, size_t vertex) {
+	int init_label { chromosome.genes[vertex] };
+	const NeighborhoodWeight& weight { chromosome.neighborhood[vertex] };
+	
+	for (int label : {0, 2, 3}) {
+		if (label >= init_label) {
+			return;
+		}
+		
+		if (label + weight.label_sum >= 3 + weight.active) {
+			if (labelChangeIsFeasible(graph, chromosome, vertex, label)) {
+				chromosome.setGene(graph, vertex, label);
+			}
+			
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Lowers the label of `vertex` to the smallest of 0, 2 and 3 that keeps its closed neighborhood feasible. 
+ * Unlike `decreaseLabel`, every smaller label is tried. Requires the neighborhood cache; O(deg(vertex)) per label.
  * 
- * @note This function modifies the solution vector in place, and ensures that the solution remains 
- *       feasible after modifying the label of the vertex. If no feasible configuration is found, 
- *       the vertex's label is reverted to its initial value.
+ * @return Whether the label changed.
  */
 
-void decreaseLabel(const Graph& graph, std::vector<int>& solution, size_t vertex) {
-	size_t init_label = solution[vertex];
-	std::vector<int> active_neighborhood;
+static bool lowerLabel(const CSRGraph& graph, Chromosome& chromosome, size_t vertex) {
+	int current_label { chromosome.genes[vertex] };
 	
+	for (int label : {0, 2, 3}) {
+		if (label >= current_label) {
+			return false;
+		}
+		
+		if (labelChangeIsFeasible(graph, chromosome, vertex, label)) {
+			chromosome.setGene(graph, vertex, label);
+			return true;
+		}
+	}
 	
-	for (const auto& it: graph.getAdjacencyList(vertex)) {
-		active_neighborhood.push_back(it);	
+	return false;
+}
+
+/**
+ * @brief Splits the label 4 of `vertex` into 2 on `vertex` and 2 on its neighbor `partner` (labelled 0), which keeps 
+ * the weight, and then tries to lower the labels around `partner`, whose neighbors gained support. The split is kept 
+ * only if the weight ends up smaller; otherwise every change is undone.
+ * 
+ * @param moves Incremented for every label change evaluated after the split.
+ * @return Whether the split was kept.
+ */
+
+static bool splitLabel(const CSRGraph& graph, Chromosome& chromosome, size_t vertex, size_t partner, size_t& moves) {
+	thread_local std::vector<std::pair<size_t, Gene>> changes;
+	
+	const size_t initial_fitness { chromosome.fitness };
+	
+	changes.clear();
+	changes.emplace_back(vertex, chromosome.genes[vertex]);
+	changes.emplace_back(partner, chromosome.genes[partner]);
+	
+	chromosome.setGene(graph, vertex, 2);
+	chromosome.setGene(graph, partner, 2);
+	
+	// only `vertex` and its neighbors lost support; the neighbors of `partner` only gained it.
+	bool valid { feasible(graph, chromosome, vertex) };
+	
+	for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+		valid = valid && feasible(graph, chromosome, neighbor);
 	}
 	
-	if (init_label == 2) {
-		solution[vertex] = 0;
+	if (valid) {
+		for (const auto& neighbor : graph.getAdjacencyList(partner)) {
+			Gene label { chromosome.genes[neighbor] };
 			
-		if (!feasible(graph, solution, vertex)) { 
-    		solution[vertex] = init_label;      
+			if (label > 0) {
+				++moves;
+				
+				if (lowerLabel(graph, chromosome, neighbor)) {
+					changes.emplace_back(neighbor, label);
+				}
+			}
 		}
-		
 	}
 	
-	else if (init_label == 3) {
-		solution[vertex] = 0;
-		
-		if (!feasible(graph, solution, vertex)) {
-			solution[vertex] = 2;
-			if (!feasible(graph, solution, vertex)) {
-				solution[vertex] = init_label;      
+	if (valid && chromosome.fitness < initial_fitness) {
+		return true;
+	}
+	
+	for (auto change { changes.rbegin() }; change != changes.rend(); ++change) {
+		chromosome.setGene(graph, change->first, change->second);
+	}
+	
+	return false;
+}
+
+/**
+ * @brief Memetic improvement of a feasible chromosome, keeping it feasible.
+ * 
+ * The first pass lowers labels, visiting the vertices labelled 4, then 3, then 2, so the heaviest labels are freed 
+ * first; lowering a label to 0 removes a redundant vertex. The second pass tries, for every vertex still labelled 
+ * 4, to split its label with a neighbor labelled 0 (see `splitLabel`). Every move is evaluated in O(deg) with the 
+ * neighborhood cache, which is built for the duration of the call if it was not active.
+ * 
+ * @param budget Maximum number of moves evaluated; 0 means no limit.
+ * @return The number of moves evaluated.
+ */
+
+size_t localSearch(const CSRGraph& graph, Chromosome& chromosome, size_t budget) {
+	bool had_cache { chromosome.hasNeighborhoodCache() };
+	
+	if (!had_cache) {
+		chromosome.buildNeighborhoodCache(graph);
+	}
+	
+	const size_t order { chromosome.genes.size() };
+	size_t moves {0};
+	bool exhausted {false};
+	
+	for (int label : {4, 3, 2}) {
+		for (size_t vertex {0}; vertex < order && !exhausted; ++vertex) {
+			if (chromosome.genes[vertex] == label) {
+				++moves;
+				lowerLabel(graph, chromosome, vertex);
+				exhausted = budget > 0 && moves >= budget;
 			}
 		}
 	}
+	
+	for (size_t vertex {0}; vertex < order && !exhausted; ++vertex) {
+		if (chromosome.genes[vertex] != 4) { continue; }
 		
-	else if (init_label == 4) {
-		solution[vertex] = 0;
-		
-		if (!feasible(graph, solution, vertex)) {
-			solution[vertex] = 2;
-
-			if (!feasible(graph, solution, vertex)) {
-				solution[vertex] = 3;
-				
-				if (!feasible(graph, solution, vertex)) {
-		    		solution[vertex] = init_label;      
-				}
-			}
+		for (const auto& neighbor : graph.getAdjacencyList(vertex)) {
+			if (chromosome.genes[neighbor] != 0) { continue; }
+			
+			++moves;
+			bool kept { splitLabel(graph, chromosome, vertex, neighbor, moves) };
+			exhausted = budget > 0 && moves >= budget;
+			
+			if (kept || exhausted) { break; }
 		}
 	}
 	
-	if (!activeNeighborhoodIsFeasible(graph, solution, active_neighborhood)) {
-		solution[vertex] = init_label;      	
-	} 
+	if (!had_cache) {
+		chromosome.clearNeighborhoodCache();
+	}
+	
+	return moves;
 }
 
-Chromosome& fitness(Chromosome& chromosome) {
-	chromosome.fitness = 0;
-	for (auto& gene: chromosome.genes) {
-		chromosome.fitness += gene;
+static size_t sumLabelsScalar(const Gene* genes, size_t size) {
+	size_t sum {0};
+	
+	for (size_t i {0}; i < size; ++i) {
+		sum += genes[i];
+	}
+	
+	return sum;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+// `sad_epu8` against zero adds each group of 8 bytes into a 64-bit lane, so the accumulators cannot overflow.
+
+__attribute__((target("avx2")))
+static size_t sumLabelsAVX2(const Gene* genes, size_t size) {
+	const __m256i zero { _mm256_setzero_si256() };
+	__m256i sum { _mm256_setzero_si256() };
+	size_t i {0};
+	
+	for (; i + 32 <= size; i += 32) {
+		__m256i block { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(genes + i)) };
+		sum = _mm256_add_epi64(sum, _mm256_sad_epu8(block, zero));
+	}
+	
+	uint64_t lanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sum);
+	
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumLabelsScalar(genes + i, size - i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static size_t sumLabelsAVX512(const Gene* genes, size_t size) {
+	const __m512i zero { _mm512_setzero_si512() };
+	__m512i sum { _mm512_setzero_si512() };
+	size_t i {0};
+	
+	for (; i + 64 <= size; i += 64) {
+		__m512i block { _mm512_loadu_si512(genes + i) };
+		sum = _mm512_add_epi64(sum, _mm512_sad_epu8(block, zero));
 	}
+	
+	uint64_t lanes[8];
+	_mm512_storeu_si512(lanes, sum);
+	
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7] + 
+		sumLabelsScalar(genes + i, size - i);
+}
+
+#endif
+
+/**
+ * @brief Returns the sum of `size` labels. The AVX-512 or AVX2 kernel is chosen once, at the first call, from 
+ * what the running CPU supports; other targets use the scalar loop.
+ */
+
+size_t sumLabels(const Gene* genes, size_t size) {
+	using Kernel = size_t (*)(const Gene*, size_t);
+	
+	static const Kernel kernel { [] {
+#if defined(__GNUC__) && defined(__x86_64__)
+		if (__builtin_cpu_supports("avx512bw")) { return &sumLabelsAVX512; }
+		if (__builtin_cpu_supports("avx2")) { return &sumLabelsAVX2; }
+#endif
+		return &sumLabelsScalar;
+	}() };
+	
+	return kernel(genes, size);
+}
+
+/**
+ * @brief Recomputes the chromosome fitness from scratch. Gene changes made through `Chromosome::setGene` keep 
+ * the fitness up to date, so this is only needed after the genes are written directly.
+ */
+
+Chromosome& fitness(Chromosome& chromosome) {
+	chromosome.fitness = sumLabels(chromosome.genes.data(), chromosome.genes.size());
         		
  	return chromosome; 
 }
 
-int computeRightLowerBound(const Graph& graph, int lowerBound) {
+/**
+ * @brief Computes the mean and the (population) standard deviation of the fitness in a single pass.
+ *
+ * Fitness values are integers, so the sum and the sum of squares are accumulated exactly and the variance 
+ * `E[x^2] - E[x]^2` does not suffer from cancellation.
+ */
+
+void fitnessStatistics(const std::vector<Chromosome>& population, float& mean, float& standard_deviation) {
+	uint64_t sum {0};
+	uint64_t sum_squares {0};
+	
+	for (const auto& individual : population) {
+		sum += individual.fitness;
+		sum_squares += static_cast<uint64_t>(individual.fitness) * individual.fitness;
+	}
+	
+	const double size { static_cast<double>(population.size()) };
+	const double average { sum / size };
+	const double variance { std::max(0.0, sum_squares / size - average * average) };
+	
+	mean = static_cast<float>(average);
+	standard_deviation = static_cast<float>(std::sqrt(variance));
+}
+
+/**
+ * @brief Measures how diverse a population is: the number of distinct genomes and the mean Hamming distance 
+ * over all pairs of individuals.
+ *
+ * The pairwise distance is computed from per-position label counts: at a position where label `l` occurs `c_l` 
+ * times, `(P^2 - sum c_l^2) / 2` of the `P(P - 1) / 2` pairs differ. This takes O(P n) instead of O(P^2 n).
+ */
+
+PopulationDiversity populationDiversity(const std::vector<Chromosome>& population) {
+	const size_t size { population.size() };
+	
+	if (size == 0) { return {0, 0.0f}; }
+	
+	const size_t genes_size { population[0].genes.size() };
+	
+	std::vector<size_t> order(size);
+	
+	for (size_t i {0}; i < size; ++i) {
+		order[i] = i;
+	}
+	
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+		return population[a].genes < population[b].genes;
+	});
+	
+	size_t distinct_genomes {1};
+	
+	for (size_t i {1}; i < size; ++i) {
+		if (population[order[i]].genes != population[order[i - 1]].genes) {
+			++distinct_genomes;
+		}
+	}
+	
+	if (size == 1) { return {distinct_genomes, 0.0f}; }
+	
+	// labels are in {0, ..., 4} once a chromosome is built.
+	constexpr size_t labels {5};
+	std::vector<uint32_t> counts(genes_size * labels, 0);
+	
+	for (const auto& individual : population) {
+		for (size_t i {0}; i < genes_size; ++i) {
+			++counts[i * labels + individual.genes[i]];
+		}
+	}
+	
+	uint64_t differing_ordered_pairs {0};
+	
+	for (size_t i {0}; i < genes_size; ++i) {
+		uint64_t same_ordered_pairs {0};
+		
+		for (size_t label {0}; label < labels; ++label) {
+			same_ordered_pairs += static_cast<uint64_t>(counts[i * labels + label]) * counts[i * labels + label];
+		}
+		
+		differing_ordered_pairs += static_cast<uint64_t>(size) * size - same_ordered_pairs;
+	}
+	
+	return {distinct_genomes, static_cast<float>(static_cast<double>(differing_ordered_pairs) / (size * (size - 1)))};
+}
+
+// os graus mínimo e máximo são calculados uma única vez, na construção do grafo CSR.
+
+int computeRightLowerBound(const CSRGraph& graph, int lowerBound) {
     lowerBound = -1; 
-    if (graph.getMaxDegree() >= 3 && graph.getOrder() >= 2) {
-        lowerBound = std::ceil(static_cast<size_t>(4.0 * graph.getOrder() / (graph.getMaxDegree() + 1.0)));
+    const size_t max_degree { graph.getMaxDegree() };
+    
+    if (max_degree >= 3 && graph.getOrder() >= 2) {
+        lowerBound = std::ceil(static_cast<size_t>(4.0 * graph.getOrder() / (max_degree + 1.0)));
 	}
 	
     return lowerBound;
 }
 
-int computeRightUpperBound(Graph& graph, int upperBound) {
+int computeRightUpperBound(const CSRGraph& graph, int upperBound) {
     upperBound = -1;
     auto components { graph.connectedComponents() };
     
@@ -0,0 +1,91 @@
+#include "CSRGraph.hpp"
+#include "Chromosome.hpp"
+#include "GraphGenerator.hpp"
+#include "util_functions.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Differential test of the incremental `feasibilityCheck`: on random feasible chromosomes, a few `setGene` edits
+// followed by the incremental repair (of the changed vertices, or of the single changed vertex) must give the same
+// genes and fitness as the full repair of the same edited chromosome.
+
+namespace {
+
+constexpr Gene labels[] {0, 2, 3, 4};
+
+size_t failures {0};
+
+void check(bool condition, const std::string& description) {
+    if (!condition) {
+        std::cerr << "FAILED: " << description << '\n';
+        ++failures;
+    }
+}
+
+Chromosome randomFeasibleChromosome(const CSRGraph& graph) {
+    Chromosome chromosome(graph.getOrder());
+
+    for (auto& gene : chromosome.genes) {
+        gene = labels[getRandomInt(0, 3)];
+    }
+
+    return feasibilityCheck(graph, chromosome);
+}
+
+void compareRepairs(const CSRGraph& graph, const std::string& name, size_t trials, size_t max_edits) {
+    for (size_t trial {0}; trial < trials; ++trial) {
+        Chromosome edited { randomFeasibleChromosome(graph) };
+        std::vector<size_t> changed_vertices;
+        size_t edits { getRandomInt(1, max_edits) };
+
+        for (size_t i {0}; i < edits; ++i) {
+            size_t vertex { getRandomInt(0, graph.getOrder() - 1) };
+            edited.setGene(graph, vertex, labels[getRandomInt(0, 3)]);
+            changed_vertices.push_back(vertex);
+        }
+
+        Chromosome full { edited };
+        Chromosome incremental { edited };
+
+        feasibilityCheck(graph, full);
+        feasibilityCheck(graph, incremental, changed_vertices);
+
+        const std::string description { name + " trial " + std::to_string(trial) };
+
+        check(feasible(graph, full.genes), description + ": full repair is not feasible");
+        check(incremental.genes == full.genes, description + ": genes differ");
+        check(incremental.fitness == full.fitness, description + ": fitness differs");
+
+        if (edits == 1) {
+            Chromosome single { edited };
+            feasibilityCheck(graph, single, changed_vertices.front());
+
+            check(single.genes == full.genes && single.fitness == full.fitness,
+                description + ": single-vertex repair differs");
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    setRandomSeed(1);
+
+    for (uint64_t seed {1}; seed <= 3; ++seed) {
+        compareRepairs(generateErdosRenyiGraph(200, 0.02, seed), "gnp-200-sparse-" + std::to_string(seed), 300, 5);
+        compareRepairs(generateErdosRenyiGraph(100, 0.5, seed), "gnp-100-dense-" + std::to_string(seed), 300, 5);
+        compareRepairs(generateBarabasiAlbertGraph(500, 2, seed), "ba-500-" + std::to_string(seed), 300, 20);
+        compareRepairs(generateGeometricGraph(500, 0.08, seed), "geometric-500-" + std::to_string(seed), 300, 20);
+    }
+
+    compareRepairs(CSRGraph("input_file/random_graph11-order100-edge_probability-0.5.txt"), "file-100-0.5", 300, 5);
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "feasibilityCheck: incremental and full repairs agree\n";
+    return EXIT_SUCCESS;
+}